@@ -21,6 +21,7 @@
 #include "Engine/Core/Application.h"
 #include "Engine/Core/Time.h"
 #include "Engine/Core/Input.h"
+#include "Engine/Core/JobSystem.h"
 #include "Engine/Resource/ResourceManager.h"
 #include "Engine/Audio/AudioManager.h"
 #include "Engine/Editor/Core/Editor.h"
@@ -47,6 +48,9 @@ Application::~Application()
 	// I[fBI
 	AudioManager::Instance().Finalize();
 
+	// [J[Xbh
+	JobSystem::Instance().Finalize();
+
 	// ComPtrgpĂ邽߁AIRelease͕sv
 }
 
@@ -186,6 +190,7 @@ void Application::Initialize()
 	// }l[W[
 	ResourceManager::Instance().Initialize(m_device.Get());
 	AudioManager::Instance().Initialize();	// I[fBI
+	JobSystem::Instance().Initialize();		// [J[XbhiRAj
 	ResourceManager::Instance().LoadManifest("Resources/resources.json");
 	ResourceManager::Instance().LoadAll();
 
@@ -259,13 +264,10 @@ void Application::Render()
 		float aspect = m_sceneWindowSize.x / m_sceneWindowSize.y;
 		auto& reg = m_sceneManager.GetWorld().getRegistry();
 
-		reg.view<Tag, Camera>([&](Entity e, Tag& tag, Camera& cam)
-			{
-				if (tag.name == "MainCamera")
-				{
-					cam.aspect = aspect;
-				}
-			});
+		for (Entity e : reg.find_all_by_name<Tag>("MainCamera"))
+		{
+			if (reg.has<Camera>(e)) reg.get<Camera>(e).aspect = aspect;
+		}
 
 		m_sceneRT->Resize(m_device.Get(), (int)m_sceneWindowSize.x, (int)m_sceneWindowSize.y);
 	}
@@ -340,9 +342,12 @@ void Application::Render()
 		bool cameraFound = false;
 
 		World& world = m_sceneManager.GetWorld();
- 		m_sceneManager.GetWorld().getRegistry().view<Tag, Camera, Transform>([&](Entity e, Tag& tag, Camera& cam, Transform& t) {
-			if (!cameraFound && tag.name == "MainCamera")
+		Registry& reg = world.getRegistry();
+		for (Entity e : reg.find_all_by_name<Tag>("MainCamera")) {
+			if (!cameraFound && reg.has<Camera>(e) && reg.has<Transform>(e))
 			{
+				Camera& cam = reg.get<Camera>(e);
+				Transform& t = reg.get<Transform>(e);
 				XMVECTOR eye = XMLoadFloat3(&t.position);
 				XMMATRIX rot = XMMatrixRotationRollPitchYaw(t.rotation.x, t.rotation.y, 0.0f);
 				XMVECTOR look = XMVector3TransformCoord(XMVectorSet(0, 0, 1, 0), rot);
@@ -354,7 +359,7 @@ void Application::Render()
 
 				cameraFound = true;
 			}
-			});
+		}
 
 	if (cameraFound)
 	{
@@ -384,8 +389,10 @@ void Application::Render()
 			// ȈՓIɃCJT (fobOJΉ͌ق)
 			// V[}l[WoRWorldɃANZX
 			World& world = m_sceneManager.GetWorld();
-			world.getRegistry().view<Tag, Camera, Transform>([&](Entity e, Tag& tag, Camera& cam, Transform& t) {
-				if (!cameraFound && strcmp(tag.name.c_str(), "MainCamera") == 0) {
+			for (Entity e : reg.find_all_by_name<Tag>("MainCamera")) {
+				if (!cameraFound && reg.has<Camera>(e) && reg.has<Transform>(e)) {
+					Camera& cam = reg.get<Camera>(e);
+					Transform& t = reg.get<Transform>(e);
 					camPos = XMLoadFloat3(&t.position);
 
 					// svZ (RenderSystemƓWbN)
@@ -397,7 +404,7 @@ void Application::Render()
 					proj = XMMatrixPerspectiveFovLH(cam.fov, cam.aspect, cam.nearZ, cam.farZ);
 					cameraFound = true;
 				}
-				});
+			}
 
 			if (cameraFound) {
 				// 4. C̍쐬 (Unproject)
@@ -414,9 +421,15 @@ void Application::Render()
 				XMStoreFloat3(&origin, rayOrigin);
 				XMStoreFloat3(&dir, rayDir);
 
-				// 5. CLXgs
+				// 5. CLXgsiCollisionSystem BVHŁAΑj
+				CollisionSystem* collision = nullptr;
+				for (auto& sys : world.getSystems()) {
+					if (auto* c = dynamic_cast<CollisionSystem*>(sys.get())) collision = c;
+				}
+
 				float dist;
-				Entity hit = CollisionSystem::Raycast(world.getRegistry(), origin, dir, dist);
+				Entity hit = collision ? collision->RaycastClosest(origin, dir, dist)
+					: CollisionSystem::Raycast(world.getRegistry(), origin, dir, dist);
 
 				// 6. IԂ̍XV (Editor̃oXV)
 				// EditorɁuI֐vǉ邩ApublicoɂKv܂A
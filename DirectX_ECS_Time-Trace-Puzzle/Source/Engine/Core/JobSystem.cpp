@@ -0,0 +1,153 @@
+/*****************************************************************//**
+ * @file	JobSystem.cpp
+ * @brief	[J[Xbhŏ𕪊sNX
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Engine/Core/JobSystem.h"
+#include <algorithm>
+
+namespace
+{
+	constexpr uint32_t NotInJob = 0xFFFFFFFFu;
+
+	// ̃XbhsĂd threadIndexid̊OȂ NotInJobj
+	// d̒ ParallelFor Ă΂ꂽiqj̔ƁA̎ɓnԍɎg
+	thread_local uint32_t t_jobThreadIndex = NotInJob;
+
+	/**
+	 * @struct	JobScope
+	 * @brief	func ĂłԂ t_jobThreadIndex ݒ肷
+	 */
+	struct JobScope
+	{
+		uint32_t previous;
+		explicit JobScope(uint32_t threadIndex) : previous(t_jobThreadIndex) { t_jobThreadIndex = threadIndex; }
+		~JobScope() { t_jobThreadIndex = previous; }
+	};
+}
+
+void JobSystem::Initialize(uint32_t threadCount)
+{
+	Finalize();
+
+	if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	m_quit = false;
+	for (uint32_t i = 1; i < threadCount; ++i)
+	{
+		m_workers.emplace_back(&JobSystem::WorkerLoop, this, i, m_generation);
+	}
+}
+
+void JobSystem::Finalize()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+	m_wakeCondition.notify_all();
+	for (auto& worker : m_workers)
+	{
+		if (worker.joinable()) worker.join();
+	}
+	m_workers.clear();
+}
+
+void JobSystem::SetThreadCount(uint32_t threadCount)
+{
+	if (threadCount == GetThreadCount()) return;
+	std::lock_guard<std::mutex> call(m_callMutex);
+	Initialize(threadCount);
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const RangeFunc& func)
+{
+	if (count == 0) return;
+	batchSize = std::max(1u, batchSize);
+
+	// qi[J[EĂяôǂłj͂̏Ŏs
+	// m_callMutex 蒼Ǝ~܂AthreadIndex 0 nƊO̎dƃXbhƂ̃obt@LĂ܂߁A
+	// O̎dƓԍniXbhȂ̂œɂ͎gȂj
+	if (t_jobThreadIndex != NotInJob)
+	{
+		func(0, count, t_jobThreadIndex);
+		return;
+	}
+
+	// [J[E1ŏIꍇ͂̏Ŏs
+	if (m_workers.empty() || count <= batchSize)
+	{
+		JobScope scope(0);
+		func(0, count, 0);
+		return;
+	}
+
+	std::lock_guard<std::mutex> call(m_callMutex);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_func = &func;
+		m_count = count;
+		m_batchSize = batchSize;
+		m_next.store(0);
+		m_running = (uint32_t)m_workers.size();
+		++m_generation;
+	}
+	m_wakeCondition.notify_all();
+
+	// ĂяoQ
+	RunBatches(0);
+
+	// S[J[܂ő҂ifunc QƂĂ邽߁j
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_doneCondition.wait(lock, [this] { return m_running == 0; });
+	m_func = nullptr;
+}
+
+void JobSystem::RunBatches(uint32_t threadIndex)
+{
+	JobScope scope(threadIndex);
+	for (;;)
+	{
+		uint32_t begin = m_next.fetch_add(m_batchSize);
+		if (begin >= m_count) break;
+		uint32_t end = std::min(m_count, begin + m_batchSize);
+		(*m_func)(begin, end, threadIndex);
+	}
+}
+
+void JobSystem::WorkerLoop(uint32_t threadIndex, uint32_t seenGeneration)
+{
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wakeCondition.wait(lock, [&] { return m_quit || m_generation != seenGeneration; });
+			if (m_quit) return;
+			seenGeneration = m_generation;
+		}
+
+		RunBatches(threadIndex);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			--m_running;
+		}
+		m_doneCondition.notify_one();
+	}
+}
@@ -0,0 +1,89 @@
+/*****************************************************************//**
+ * @file	JobSystem.h
+ * @brief	[J[Xbhŏ𕪊sNX
+ *
+ * @details
+ * NɃ[J[XbhĂAParallelFor  [0, count) ɂĔz܂B
+ * ĂяoXbhgɎQASďI܂Ŗ߂܂B
+ * O⃏[J[0{̎AqŌĂ΂ꂽ́AĂяoXbhł̂܂܎s܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___JOB_SYSTEM_H___
+#define ___JOB_SYSTEM_H___
+
+// ===== CN[h =====
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @class	JobSystem
+ * @brief	ParallelFor p̃Xbhv[
+ */
+class JobSystem
+{
+public:
+	// func(begin, end, threadIndex)BthreadIndex  0 ` GetThreadCount()-1i0 ͌Ăяoj
+	using RangeFunc = std::function<void(uint32_t, uint32_t, uint32_t)>;
+
+	static JobSystem& Instance()
+	{
+		static JobSystem instance;
+		return instance;
+	}
+
+	// threadCount ͌Ăяo܂߂Xbhi0 Ȃ CPU ̃RAj
+	void Initialize(uint32_t threadCount = 0);
+	void Finalize();
+
+	// Xbh̕ύXivpB[J[蒼j
+	void SetThreadCount(uint32_t threadCount);
+	uint32_t GetThreadCount() const { return (uint32_t)m_workers.size() + 1; }
+
+	/**
+	 * @brief	[0, count)  batchSize ĕɎs
+	 * @details	func ̒Ă΂ꂽꍇiqj́A[J[EĂяôǂł
+	 *			̃Xbhł܂Ƃ߂ĎsAthreadIndex ɂ͊O̎dƓԍn܂B
+	 */
+	void ParallelFor(uint32_t count, uint32_t batchSize, const RangeFunc& func);
+
+private:
+	JobSystem() = default;
+	~JobSystem() { Finalize(); }
+
+	void WorkerLoop(uint32_t threadIndex, uint32_t seenGeneration);
+	void RunBatches(uint32_t threadIndex);
+
+	std::vector<std::thread> m_workers;
+	std::mutex m_mutex;
+	std::condition_variable m_wakeCondition;
+	std::condition_variable m_doneCondition;
+	std::mutex m_callMutex;		// ParallelFor ͓1
+
+	// s̎d
+	const RangeFunc* m_func = nullptr;
+	uint32_t m_count = 0;
+	uint32_t m_batchSize = 1;
+	std::atomic<uint32_t> m_next{ 0 };
+	uint32_t m_generation = 0;	// VdƂɑ
+	uint32_t m_running = 0;		// ̃[J[
+	bool m_quit = false;
+};
+
+#endif // !___JOB_SYSTEM_H___
@@ -37,6 +37,11 @@
 #include <type_traits>
 #include <cassert>
 #include <chrono>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <functional>
+#include <tuple>
 
 // ------------------------------------------------------------
 // 1. {` & ComponentFamiliy
@@ -61,9 +66,48 @@ public:
 	}
 };
 
+/**
+ * @class	Revision
+ * @brief	v[̕ύXԍ
+ * @details
+ * Sv[1̃JE^L̂ŁAV[؂ւŃv[蒼Ă
+ * ȑOɊoԍƋRv邱Ƃ͂܂B
+ */
+class Revision
+{
+public:
+	static uint64_t next()
+	{
+		static uint64_t value = 0;
+		return ++value;
+	}
+};
+
 // ------------------------------------------------------------
 // 2. Pool & SparseSet
 // ------------------------------------------------------------
+/**
+ * @class	Span
+ * @brief	A̎QƁiC++17p̊Ȉ std::spanj
+ */
+template<typename T>
+class Span
+{
+	T* ptr = nullptr;
+	size_t count = 0;
+
+public:
+	Span() = default;
+	Span(T* p, size_t n) : ptr(p), count(n) {}
+
+	T* data() const { return ptr; }
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+	T& operator[](size_t i) const { return ptr[i]; }
+	T* begin() const { return ptr; }
+	T* end() const { return ptr + count; }
+};
+
 class IPool
 {
 public:
@@ -79,6 +123,22 @@ class SparseSet
 	std::vector<Entity> sparse;	// Entity ID -> Dense Index
 	std::vector<Entity> dense;	// Dense Index -> Entity ID
 	std::vector<T> data;		// Component DataiDensezƓj
+	std::vector<uint64_t> versions;	// Entity ID -> ǉꂽ̕ύXԍiԍŕtꂽ̔pj
+
+	// ǉE폜̃R[obNiOCfbNXȂǂ̈ێpj
+	std::function<void(Entity, const T&)> onConstruct;
+	std::function<void(Entity, const T&)> onDestroy;
+
+	// O[viRegistry::groupj̈ێpBǉ̌E폜̑OɌĂ΂
+	std::function<void(Entity)> onGroupAdd;
+	std::function<void(Entity)> onGroupRemove;
+
+	// ǉE폜Epatch ̂тɍXViLbV̍蒼pj
+	uint64_t revision = Revision::next();
+
+	// gςƈtꂽ Entityirevision ͕ςȂB󂯎j
+	std::vector<Entity> marked;
+	std::vector<uint8_t> markedFlags;	// Entity ID -> 󂪕tĂ邩i Entity 2ς܂Ȃj
 
 public:
 	// R|[lg݂邩
@@ -101,13 +161,20 @@ public:
 		if (sparse.size() <= entity)
 		{
 			sparse.resize(entity + 1);
+			versions.resize(entity + 1, 0);
 		}
 
 		sparse[entity] = (Entity)dense.size();
 		dense.push_back(entity);
 		data.emplace_back(std::forward<Args>(args)...);
+		revision = Revision::next();
+		versions[entity] = revision;
+
+		if (onConstruct) onConstruct(entity, data.back());
+		// O[vɓƈʒuς̂ŁAł͂Ȃ
+		if (onGroupAdd) onGroupAdd(entity);
 
-		return data.back();
+		return data[sparse[entity]];
 	}
 
 	// R|[lg̎擾
@@ -122,6 +189,11 @@ public:
 	{
 		if (!has(entity)) return;
 
+		// ɃO[v̊Oi擪̕т̌j֏oĂ
+		if (onGroupRemove) onGroupRemove(entity);
+		if (onDestroy) onDestroy(entity, data[sparse[entity]]);
+		revision = Revision::next();
+
 		Entity lastEntity = dense.back();
 		Entity indexToRemove = sparse[entity];
 
@@ -140,6 +212,300 @@ public:
 	// f[^ւ̒ڃANZXiSystemł̃[vpj
 	std::vector<T>& getData() { return data; }
 	const std::vector<Entity>& getEntities() const { return dense; }
+
+	// ǉE폜̃R[obNݒ
+	void setHooks(std::function<void(Entity, const T&)> construct, std::function<void(Entity, const T&)> destroy)
+	{
+		onConstruct = std::move(construct);
+		onDestroy = std::move(destroy);
+	}
+
+	// O[v̈ێݒi1̃v[1̃O[vɂȂj
+	void setGroupHooks(std::function<void(Entity)> add, std::function<void(Entity)> remove)
+	{
+		assert(!onGroupAdd && "̃R|[lg͊ɕʂ̃O[vɓĂ܂");
+		onGroupAdd = std::move(add);
+		onGroupRemove = std::move(remove);
+	}
+
+	// ύXԍ
+	uint64_t getRevision() const { return revision; }
+
+	// entity ɂ̃R|[lgǉꂽ̕ύXԍi폜ĕtƕςBv[ŜŏdȂȂj
+	uint64_t version(Entity entity) const { return entity < versions.size() ? versions[entity] : 0; }
+
+	// g𒼐ڏƂm点
+	void touch() { revision = Revision::next(); }
+
+	// gς Entity Ɉt
+	void mark(Entity entity)
+	{
+		if (markedFlags.size() <= entity) markedFlags.resize((size_t)entity + 1, 0);
+		if (markedFlags[entity]) return;
+		markedFlags[entity] = 1;
+		marked.push_back(entity);
+	}
+
+	// ̕t Entity nAi폜ꂽ Entity ܂܂j
+	template<typename Func>
+	void drainMarked(Func func)
+	{
+		for (Entity entity : marked) {
+			markedFlags[entity] = 0;
+			func(entity);
+		}
+		marked.clear();
+	}
+
+	// Densez̈ʒu
+	size_t index(Entity entity) const
+	{
+		assert(has(entity));
+		return sparse[entity];
+	}
+
+	// Densez2vfւiO[v̐pj
+	void swapDense(size_t i, size_t j)
+	{
+		if (i == j) return;
+		std::swap(dense[i], dense[j]);
+		std::swap(data[i], data[j]);
+		sparse[dense[i]] = (Entity)i;
+		sparse[dense[j]] = (Entity)j;
+	}
+};
+
+/**
+ * @class	SharedSet
+ * @brief	l̃R|[lg1ɂ܂Ƃ߂ċLv[itCEFCgj
+ * @details
+ * Entity͒l̂̂ł͂Ȃuǂ̃O[viljɑĂ邩v܂B
+ * eO[v͒l1ƏEntitỹXgAXg̃TCYQƃJEgɂȂ܂B
+ * Entity0ɂȂO[v͉Aɒǉlōėp܂B
+ * lO[vւ̓nbVň̂ŁAǉEtւ̓O[v̐ɂ炸 O(1) łB
+ * @note	T ɂ operator==  std::hash<T> ̓ꉻKvł
+ */
+template<typename T>
+class SharedSet
+	: public IPool
+{
+	static constexpr uint32_t InvalidGroup = 0xFFFFFFFF;
+
+	struct Slot
+	{
+		uint32_t group = InvalidGroup;	// O[v
+		uint32_t index = 0;				// O[v̈ʒu
+	};
+
+	struct Group
+	{
+		T value;
+		std::vector<Entity> members;
+	};
+
+	std::vector<Slot> sparse;		// Entity ID -> O[v
+	std::vector<Group> groups;		// lƂ̃O[v
+	std::vector<uint32_t> freeGroups;	// 󂫃O[v
+	std::unordered_multimap<size_t, uint32_t> lookup;	// l̃nbV -> gp̃O[viՓˎ͕j
+
+	// l̃O[vTi΍쐬j
+	uint32_t acquire(T&& value)
+	{
+		const size_t hash = std::hash<T>{}(value);
+		auto range = lookup.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (groups[it->second].value == value) return it->second;
+		}
+
+		uint32_t id;
+		if (!freeGroups.empty())
+		{
+			id = freeGroups.back();
+			freeGroups.pop_back();
+			groups[id].value = std::move(value);
+		}
+		else
+		{
+			id = (uint32_t)groups.size();
+			groups.push_back({ std::move(value), {} });
+		}
+		lookup.emplace(hash, id);
+		return id;
+	}
+
+	// gȂȂO[v
+	void release(uint32_t id)
+	{
+		auto range = lookup.equal_range(std::hash<T>{}(groups[id].value));
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == id) { lookup.erase(it); break; }
+		}
+		groups[id].value = T();
+		freeGroups.push_back(id);
+	}
+
+public:
+	bool has(Entity entity) const override
+	{
+		return entity < sparse.size() && sparse[entity].group != InvalidGroup;
+	}
+
+	// l\zAl̃O[vɏiɎĂΕtւj
+	template<typename... Args>
+	const T& emplace(Entity entity, Args&&... args)
+	{
+		uint32_t id = acquire(T(std::forward<Args>(args)...));
+
+		if (has(entity))
+		{
+			if (sparse[entity].group == id) return groups[id].value;
+			remove(entity);
+		}
+
+		if (sparse.size() <= entity)
+		{
+			sparse.resize(entity + 1);
+		}
+
+		auto& members = groups[id].members;
+		sparse[entity] = { id, (uint32_t)members.size() };
+		members.push_back(entity);
+
+		return groups[id].value;
+	}
+
+	// Ll̎擾i emplace ŕtւj
+	const T& get(Entity entity) const
+	{
+		assert(has(entity));
+		return groups[sparse[entity].group].value;
+	}
+
+	void remove(Entity entity) override
+	{
+		if (!has(entity)) return;
+
+		Slot slot = sparse[entity];
+		Group& group = groups[slot.group];
+
+		// O[vŖƃXbvč폜
+		Entity lastEntity = group.members.back();
+		group.members[slot.index] = lastEntity;
+		sparse[lastEntity].index = slot.index;
+		group.members.pop_back();
+
+		sparse[entity] = {};
+
+		// NQƂȂȂ
+		if (group.members.empty()) release(slot.group);
+	}
+
+	// O[viljƂ̃[v
+	template<typename Func>
+	void each(Func func) const
+	{
+		for (const auto& group : groups)
+		{
+			if (group.members.empty()) continue;
+			func(group.value, Span<const Entity>(group.members.data(), group.members.size()));
+		}
+	}
+
+	// gp̒l̐
+	size_t groupCount() const { return groups.size() - freeGroups.size(); }
+};
+
+/**
+ * @class	NameIndex
+ * @brief	O -> Entity ̃nbV
+ * @details
+ * O͓o^1xێA std::string_view ̃nbVōŝ
+ * ɕ̊mۂ͔܂B
+ */
+class NameIndex
+{
+	struct Bucket
+	{
+		std::string name;
+		std::vector<Entity> entities;
+	};
+
+	// nbVl -> nbV̖OiՓˎ͕j
+	std::unordered_map<size_t, std::vector<Bucket>> table;
+
+	static size_t hash(std::string_view name) { return std::hash<std::string_view>{}(name); }
+
+	const Bucket* findBucket(std::string_view name) const
+	{
+		auto it = table.find(hash(name));
+		if (it == table.end()) return nullptr;
+		for (const auto& bucket : it->second)
+		{
+			if (bucket.name == name) return &bucket;
+		}
+		return nullptr;
+	}
+
+public:
+	void add(Entity entity, std::string_view name)
+	{
+		auto& buckets = table[hash(name)];
+		for (auto& bucket : buckets)
+		{
+			if (bucket.name == name)
+			{
+				bucket.entities.push_back(entity);
+				return;
+			}
+		}
+		buckets.push_back({ std::string(name), { entity } });
+	}
+
+	void remove(Entity entity, std::string_view name)
+	{
+		auto it = table.find(hash(name));
+		if (it == table.end()) return;
+
+		auto& buckets = it->second;
+		for (size_t i = 0; i < buckets.size(); ++i)
+		{
+			auto& entities = buckets[i].entities;
+			if (buckets[i].name != name) continue;
+
+			auto found = std::find(entities.begin(), entities.end(), entity);
+			if (found != entities.end())
+			{
+				*found = entities.back();
+				entities.pop_back();
+			}
+			// ɂȂO͍폜
+			if (entities.empty())
+			{
+				buckets.erase(buckets.begin() + i);
+				if (buckets.empty()) table.erase(it);
+			}
+			return;
+		}
+	}
+
+	// ŏɌEntityi NullEntityj
+	Entity find(std::string_view name) const
+	{
+		const Bucket* bucket = findBucket(name);
+		return bucket ? bucket->entities.front() : NullEntity;
+	}
+
+	// ȎSEntity
+	const std::vector<Entity>& findAll(std::string_view name) const
+	{
+		static const std::vector<Entity> empty;
+		const Bucket* bucket = findBucket(name);
+		return bucket ? bucket->entities : empty;
+	}
+
+	void clear() { table.clear(); }
 };
 
 // ------------------------------------------------------------
@@ -151,6 +517,20 @@ class Registry
 	// ėp\ID̃Xg
 	std::vector<Entity> freeIds;
 	std::vector<std::unique_ptr<IPool>> pools;
+	// R|[lgID -> OCfbNXifind_by_name ŏ߂Ďgꂽɍ쐬j
+	std::vector<std::unique_ptr<NameIndex>> nameIndices;
+
+	// O[v̌^̑g\iComponentFamily ŔԍU邽߂̌^j
+	template<typename... T>
+	struct GroupKey {};
+
+	// O[vFev[ [0, count) Entity𓯂ԂŎw
+	struct GroupData
+	{
+		size_t count = 0;
+	};
+	// GroupKey ̔ԍ -> O[vigroup() ŏ߂Ďgꂽɍ쐬j
+	std::vector<std::unique_ptr<GroupData>> groups;
 
 	// ^TɑΉv[擾i΍쐬j
 	template<typename T>
@@ -168,6 +548,55 @@ class Registry
 		return *static_cast<SparseSet<T>*>(pools[componentId].get());
 	}
 
+	// ^Tiname oj̖OCfbNX擾i΍쐬j
+	template<typename T>
+	NameIndex& getNameIndex()
+	{
+		size_t componentId = ComponentFamily::type<T>();
+		if (componentId >= nameIndices.size())
+		{
+			nameIndices.resize(componentId + 1);
+		}
+		if (!nameIndices[componentId])
+		{
+			auto index = std::make_unique<NameIndex>();
+			NameIndex* ptr = index.get();
+			auto& pool = getPool<T>();
+
+			// ɑ݂镪o^
+			auto& entities = pool.getEntities();
+			auto& data = pool.getData();
+			for (size_t i = 0; i < entities.size(); ++i)
+			{
+				ptr->add(entities[i], data[i].name);
+			}
+
+			// ȍ~͒ǉE폜ɍ킹čXV
+			pool.setHooks(
+				[ptr](Entity e, const T& c) { ptr->add(e, c.name); },
+				[ptr](Entity e, const T& c) { ptr->remove(e, c.name); });
+
+			nameIndices[componentId] = std::move(index);
+		}
+		return *nameIndices[componentId];
+	}
+
+	// LR|[lgT̃v[擾i΍쐬j
+	template<typename T>
+	SharedSet<T>& getSharedPool()
+	{
+		size_t componentId = ComponentFamily::type<SharedSet<T>>();
+		if (componentId >= pools.size())
+		{
+			pools.resize(componentId + 1);
+		}
+		if (!pools[componentId])
+		{
+			pools[componentId] = std::make_unique<SharedSet<T>>();
+		}
+		return *static_cast<SharedSet<T>*>(pools[componentId].get());
+	}
+
 public:
 	// Entity쐬
 	Entity create()
@@ -211,6 +640,138 @@ public:
 		getPool<T>().remove(entity);
 	}
 
+	/**
+	 * @brief	R|[lg𒼐ڏƂm点
+	 * @details
+	 * GfB^ȂǂŁAi͓Ȃ́iÓIȓ蔻ȂǁjҏWɌĂт܂B
+	 * revision<T>() ĂVXeLbV蒼܂B
+	 */
+	template<typename T>
+	void patch(Entity entity)
+	{
+		assert(has<T>(entity));
+		getPool<T>().touch();
+	}
+
+	// v[̕ύXԍiǉE폜Epatch ŕςj
+	template<typename T>
+	uint64_t revision()
+	{
+		return getPool<T>().getRevision();
+	}
+
+	/**
+	 * @brief	entity  T ǉꂽ̕ύXԍ
+	 * @details	oĂlƔׂƁA폜ꂽ Entity ̔ԍėp T tꂽƂ܂B
+	 *			ԍ͑Ŝ1̂ŁAclear() ̌ɕtĂOƓlɂ͂Ȃ܂B
+	 */
+	template<typename T>
+	uint64_t version(Entity entity)
+	{
+		return getPool<T>().version(entity);
+	}
+
+	/**
+	 * @brief	t[li[hsȂǁjۂɕς Entity Ɉt
+	 * @details
+	 * revision<T>() ͕ς܂ît[tĂALbVŜ͍蒼ȂjB
+	 * HierarchySystem A[hs񂪕ς[gɕt܂B
+	 */
+	template<typename T>
+	void mark(Entity entity)
+	{
+		getPool<T>().mark(entity);
+	}
+
+	/**
+	 * @brief	mark<T>() ꂽ Entity 1 func(Entity) ɓnA
+	 * @details	󂯎鑤1̑złB폜ꂽ Entity n̂ŁAhas<T>() Ŋm߂ĂB
+	 */
+	template<typename T, typename Func>
+	void drain_marked(Func func)
+	{
+		getPool<T>().drainMarked(func);
+	}
+
+	// ============================================================
+	// Name IndexiOj
+	// ============================================================
+	/**
+	 * @brief	OŌiO(1)AȂ NullEntityj
+	 * @details
+	 * gFEntity player = registry.find_by_name<Tag>("Player");
+	 * T  std::string name R|[lgB͒ǉE폜ɎōXV܂B
+	 * @warning	OύXꍇ͒ڏ rename() gĂ
+	 */
+	template<typename T>
+	Entity find_by_name(std::string_view name)
+	{
+		return getNameIndex<T>().find(name);
+	}
+
+	// OSEntity
+	template<typename T>
+	const std::vector<Entity>& find_all_by_name(std::string_view name)
+	{
+		return getNameIndex<T>().findAll(name);
+	}
+
+	// O̕ύXiXVj
+	template<typename T>
+	void rename(Entity entity, const std::string& name)
+	{
+		T& comp = get<T>(entity);
+		if (comp.name == name) return;
+
+		NameIndex& index = getNameIndex<T>();
+		index.remove(entity, comp.name);
+		comp.name = name;
+		index.add(entity, comp.name);
+	}
+
+	// ============================================================
+	// Shared Componentil𕡐EntityŋLj
+	// ============================================================
+	/**
+	 * @brief	LR|[lgǉilɂ΂QƂj
+	 * @details	lꍇ́Alōēx emplace_shared Ă
+	 */
+	template<typename T, typename... Args>
+	const T& emplace_shared(Entity entity, Args&&... args)
+	{
+		return getSharedPool<T>().emplace(entity, std::forward<Args>(args)...);
+	}
+
+	template<typename T>
+	bool has_shared(Entity entity)
+	{
+		return getSharedPool<T>().has(entity);
+	}
+
+	template<typename T>
+	const T& get_shared(Entity entity)
+	{
+		return getSharedPool<T>().get(entity);
+	}
+
+	template<typename T>
+	void remove_shared(Entity entity)
+	{
+		getSharedPool<T>().remove(entity);
+	}
+
+	/**
+	 * @brief	LlƂɁAgĂEntity܂Ƃ߂ēn[v
+	 * @details
+	 * gFregistry.view_shared<MeshComponent>([](const MeshComponent& m, Span<const Entity> entities) { ... });
+	 * O[vEntity̒ǉE폜Ɉێ̂ŁAt[̃\[g͕svłB
+	 */
+	template<typename T, typename Func>
+	void view_shared(Func func)
+	{
+		getSharedPool<T>().each(func);
+	}
+
 	void destroy(Entity entity)
 	{
 		for (auto& pool : pools)
@@ -231,6 +792,8 @@ public:
 			if (pool) pool.reset();
 		}
 		pools.clear();
+		nameIndices.clear();
+		groups.clear();
 		freeIds.clear();
 		nextEntity = 1;
 	}
@@ -275,6 +838,88 @@ public:
 			}
 		}
 	}
+
+	/**
+	 * @brief	wComponentSĎEntityAev[̐擪ɓԂŕׂiO[vj
+	 * @return	ׂEntity̐
+	 * @details
+	 * s͊ev[ [0, count) EntityŵŁADenseẑ܂ܘÄƂĈ܂B
+	 * ŏ̌Ăяo1xבւAȌ̓R|[lg̒ǉE폜̂т
+	 * Entity擪̕т֓ւďoꂵ܂i̕בւ͖jB
+	 * @warning	1̃R|[lg1̃O[vɂ܂B
+	 *			ǉE폜 Densez̏Ԃς̂ŁAview / each_chunk ̓rŒǉE폜Ȃ
+	 */
+	template<typename TFirst, typename... TOthers>
+	size_t group()
+	{
+		size_t groupId = ComponentFamily::type<GroupKey<TFirst, TOthers...>>();
+		if (groupId < groups.size() && groups[groupId]) return groups[groupId]->count;
+
+		if (groupId >= groups.size()) groups.resize(groupId + 1);
+		groups[groupId] = std::make_unique<GroupData>();
+		GroupData* data = groups[groupId].get();
+
+		// v[ unique_ptr ŎĂ̂ŁA|C^̓v[蒼܂ŗL
+		auto poolTuple = std::make_tuple(&getPool<TFirst>(), &getPool<TOthers>()...);
+		auto& poolFirst = *std::get<0>(poolTuple);
+
+		// --- 1. ̂1x擪ɕׂ ---
+		auto& entities = poolFirst.getEntities();
+		for (size_t i = 0; i < entities.size(); ++i)
+		{
+			Entity entity = entities[i];
+			if ((std::get<SparseSet<TOthers>*>(poolTuple)->has(entity) && ...))
+			{
+				// [0, count) ͊mς݂Ȃ̂ŁAentity ݈̌ʒu͕K count ȍ~
+				poolFirst.swapDense(i, data->count);
+				(std::get<SparseSet<TOthers>*>(poolTuple)->swapDense(
+					std::get<SparseSet<TOthers>*>(poolTuple)->index(entity), data->count), ...);
+				++data->count;
+			}
+		}
+
+		// --- 2. Ȍ͒ǉE폜̂тɁAEntityoꂷ ---
+		auto add = [poolTuple, data](Entity entity)
+			{
+				bool all = std::apply([entity](auto*... pool) { return (pool->has(entity) && ...); }, poolTuple);
+				if (!all || std::get<0>(poolTuple)->index(entity) < data->count) return;
+				std::apply([entity, data](auto*... pool) { (pool->swapDense(pool->index(entity), data->count), ...); }, poolTuple);
+				++data->count;
+			};
+		auto remove = [poolTuple, data](Entity entity)
+			{
+				auto* first = std::get<0>(poolTuple);
+				if (!first->has(entity) || first->index(entity) >= data->count) return;
+				--data->count;
+				std::apply([entity, data](auto*... pool) { (pool->swapDense(pool->index(entity), data->count), ...); }, poolTuple);
+			};
+		std::apply([&](auto*... pool) { (pool->setGroupHooks(add, remove), ...); }, poolTuple);
+
+		return data->count;
+	}
+
+	/**
+	 * @brief	ComponentEntityAAzi`NjPʂœn[v
+	 * @details
+	 * gFregistry.each_chunk<Rigidbody, Transform>([](Span<const Entity> e, Span<Rigidbody> rb, Span<Transform> t) { ... });
+	 * eSpan̓YEntityw܂B
+	 * 1vfƂ̊֐ĂяoȂ̂ŁA[v{̂RpC̎xNg
+	 * std::transformis|V[tj̑ΏۂɂȂ܂B
+	 * @warning	 group() Ăт܂i񂾂DensezבւAȌ͒ǉE폜̎Ɉێ܂j
+	 */
+	template<typename TFirst, typename... TOthers, typename Func>
+	void each_chunk(Func func)
+	{
+		size_t count = group<TFirst, TOthers...>();
+		if (count == 0) return;
+
+		auto& poolFirst = getPool<TFirst>();
+		func(
+			Span<const Entity>(poolFirst.getEntities().data(), count),
+			Span<TFirst>(poolFirst.getData().data(), count),
+			Span<TOthers>(getPool<TOthers>().getData().data(), count)...
+		);
+	}
 };
 
 // ------------------------------------------------------------
@@ -301,6 +946,14 @@ public:
 		return *this;
 	}
 
+	// LR|[lg
+	template<typename T, typename... Args>
+	EntityHandle& add_shared(Args&&... args)
+	{
+		registry->emplace_shared<T>(entity, std::forward<Args>(args)...);
+		return *this;
+	}
+
 	// ID擾ďI
 	Entity id() const { return entity; }
 };
@@ -25,9 +25,22 @@
 #include "Engine/Core/Logger.h"
 #include "Engine/ECS/ECS.h"
 #include "Game/Utils/Prefab.h"
+#include "Game/Systems/Logic/TransformBatch.h"
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include "Game/Systems/Physics/PhysicsBenchmark.h"
 
 namespace GameCommands
 {
+	// ̃R}hpBȂΌxo nullptr
+	inline CollisionSystem* FindCollisionSystem(World& world)
+	{
+		for (auto& sys : world.getSystems()) {
+			if (auto* c = dynamic_cast<CollisionSystem*>(sys.get())) return c;
+		}
+		Logger::LogWarning("Collision System not found.");
+		return nullptr;
+	}
+
 	void RegisterAll(World& world, Context& ctx)
 	{
 		// --- R}ho^ ---
@@ -104,16 +117,18 @@ namespace GameCommands
 
 			// Player^OEntityTĈړ
 			bool found = false;
-			world.getRegistry().view<Tag, Transform>([&](Entity e, Tag& tag, Transform& t) {
-				if (tag.name == "Player") {
-					t.position = { x, y, z };
+			Registry& reg = world.getRegistry();
+			for (Entity e : reg.find_all_by_name<Tag>("Player")) {
+				if (reg.has<Transform>(e)) {
+					reg.get<Transform>(e).position = { x, y, z };
+					reg.patch<Transform>(e);
 					// ZbgixȂǂ0ɂj
-					if (world.getRegistry().has<Rigidbody>(e)) {
-						world.getRegistry().get<Rigidbody>(e).velocity = { 0, 0, 0 };
+					if (reg.has<Rigidbody>(e)) {
+						reg.get<Rigidbody>(e).velocity = { 0, 0, 0 };
 					}
 					found = true;
 				}
-				});
+			}
 
 			if (found) Logger::Log("Teleported Player to (" + args[0] + ", " + args[1] + ", " + args[2] + ")");
 			else Logger::LogWarning("Player not found.");
@@ -167,9 +182,10 @@ namespace GameCommands
 
 			XMFLOAT3 pos = { 0, 5, 0 }; // ɃX|[
 			// vC[΂̋߂
-			world.getRegistry().view<Tag, Transform>([&](auto, Tag& t, Transform& tr) {
-				if (t.name == "Player") pos = tr.position;
-				});
+			Entity player = world.getRegistry().find_by_name<Tag>("Player");
+			if (player != NullEntity && world.getRegistry().has<Transform>(player)) {
+				pos = world.getRegistry().get<Transform>(player).position;
+			}
 			pos.y += 3.0f;
 
 			if (args[0] == "enemy") {
@@ -177,7 +193,7 @@ namespace GameCommands
 					.add<Tag>("Enemy")
 					.add<Transform>(pos)
 					.add<Collider>()
-					.add<MeshComponent>("hero"); // f
+					.add_shared<MeshComponent>("hero"); // f
 				Logger::Log("Spawned Enemy");
 			}
 			else if (args[0] == "sound") {
@@ -185,6 +201,208 @@ namespace GameCommands
 				Logger::Log("Spawned Sound");
 			}
 			});
+
+		// bench_transform [count] [iterations]: [hsvZiXJ[ / SIMDǰv
+		Logger::RegisterCommand("bench_transform", [](auto args) {
+			size_t count = args.size() > 0 ? (size_t)std::stoul(args[0]) : 10000;
+			int iterations = args.size() > 1 ? std::stoi(args[1]) : 100;
+
+			auto r = TransformBatch::RunBenchmark(count, iterations);
+			Logger::Log("Transform x" + std::to_string(r.count) +
+				" Scalar: " + std::to_string(r.scalarMs) + "ms / " +
+				TransformBatch::GetPathName(r.simdPath) + ": " + std::to_string(r.simdMs) + "ms" +
+				" (max error " + std::to_string(r.maxError) + ")");
+			});
+
+		// broadphase [grid/sap/tree]: u[htF[Y̐؂ւ
+		Logger::RegisterCommand("broadphase", [&world](auto args) {
+			CollisionSystem* collision = FindCollisionSystem(world);
+			if (!collision) return;
+
+			if (!args.empty()) {
+				if (args[0] == "grid") collision->SetBroadphase(Physics::BroadphaseType::Grid);
+				else if (args[0] == "sap") collision->SetBroadphase(Physics::BroadphaseType::SweepAndPrune);
+				else if (args[0] == "tree") collision->SetBroadphase(Physics::BroadphaseType::DynamicTree);
+				else { Logger::LogWarning("Usage: broadphase [grid/sap/tree]"); return; }
+			}
+			Logger::Log("Broadphase: " + std::string(Physics::GetBroadphaseName(collision->GetBroadphaseType())));
+			});
+
+		// solver [iterations] [warm 0/1] [parallel 0/1]: ڐG\o[̔񐔁EEH[X^[gEFƂ̕̕ύX
+		Logger::RegisterCommand("solver", [&world](auto args) {
+			CollisionSystem* collision = FindCollisionSystem(world);
+			if (!collision) return;
+
+			auto& solver = collision->GetSolver();
+			if (args.size() > 0) solver.SetIterations(std::stoi(args[0]));
+			if (args.size() > 1) solver.SetWarmStarting(args[1] == "1" || args[1] == "on");
+			if (args.size() > 2) solver.SetParallel(args[2] == "1" || args[2] == "on");
+			Logger::Log("Solver: " + std::to_string(solver.GetIterations()) + " iterations, warm start " +
+				(solver.IsWarmStarting() ? "ON" : "OFF") + ", parallel " + (solver.IsParallel() ? "ON" : "OFF") +
+				" (" + std::to_string(solver.GetConstraintCount()) + " contacts in " + std::to_string(solver.GetColorCount()) +
+				" colors, " + std::to_string(solver.GetOverflowCount()) + " overflow)");
+			});
+
+		// sleep [0/1]: ̖̂̐؂ւiȂŖĂ鐔\j
+		Logger::RegisterCommand("sleep", [&world](auto args) {
+			CollisionSystem* collision = FindCollisionSystem(world);
+			if (!collision) return;
+
+			auto& islands = collision->GetIslands();
+			if (!args.empty()) islands.SetEnabled(world.getRegistry(), args[0] == "1" || args[0] == "on");
+			Logger::Log("Sleep: " + std::string(islands.IsEnabled() ? "ON" : "OFF") +
+				", awake islands " + std::to_string(islands.GetAwakeIslandCount()) +
+				", sleeping " + std::to_string(islands.GetSleepingBodyCount()) + " bodies in " +
+				std::to_string(islands.GetSleepingIslandCount()) + " islands");
+			});
+
+		// gjk: GJK / EPA Ŕ肵g̐ƕς̔񐔁iO̒P̂n߂̂ŁAĂg 1, 2 j
+		Logger::RegisterCommand("gjk", [&world](auto args) {
+			CollisionSystem* collision = FindCollisionSystem(world);
+			if (!collision) return;
+
+			Logger::Log("GJK: " + std::to_string(collision->GetGJKPairCount()) + " pairs, " +
+				std::to_string(collision->GetAverageGJKIterations()) + " iterations avg");
+			});
+
+		// determinism [0/1]: _[hiŒXebvEXebvƂ̏Ԃ̃`FbNTj̐؂ւ
+		Logger::RegisterCommand("determinism", [&world](auto args) {
+			auto& determinism = Physics::Determinism::Instance();
+			if (!args.empty()) determinism.SetEnabled(args[0] == "1" || args[0] == "on");
+
+			std::string line = "Determinism: " + std::string(determinism.IsEnabled() ? "ON" : "OFF");
+			if (determinism.IsEnabled()) {
+				if (CollisionSystem* collision = FindCollisionSystem(world)) line += ", checksum " + std::to_string(collision->GetStateChecksum());
+			}
+			Logger::Log(line);
+			});
+
+		// overlap [x] [y] [z] [radius]: ƏdȂĂ铖蔻̈ꗗ
+		Logger::RegisterCommand("overlap", [&world](auto args) {
+			CollisionSystem* collision = FindCollisionSystem(world);
+			if (!collision) return;
+			if (args.size() < 4) { Logger::LogWarning("Usage: overlap [x] [y] [z] [radius]"); return; }
+
+			Entity results[64];
+			size_t count = collision->OverlapSphere({ std::stof(args[0]), std::stof(args[1]), std::stof(args[2]) }, std::stof(args[3]), results, 64);
+			std::string line = "Overlap: " + std::to_string(count);
+			for (size_t i = 0; i < std::min<size_t>(count, 64); ++i) line += " " + std::to_string(results[i]);
+			Logger::Log(line);
+			});
+
+		// layer [a] [b] [0/1]: C[m̔̐؂ւiȂňꗗj
+		Logger::RegisterCommand("layer", [](auto args) {
+			auto& matrix = Physics::LayerMatrix::Instance();
+			auto findLayer = [](const std::string& name) {
+				for (int i = 0; i < (int)CollisionLayer::Count; ++i) {
+					if (name == Physics::LayerMatrix::GetLayerName((CollisionLayer)i)) return i;
+				}
+				return -1;
+				};
+
+			if (args.size() >= 3) {
+				int a = findLayer(args[0]), b = findLayer(args[1]);
+				if (a < 0 || b < 0) { Logger::LogWarning("Unknown layer."); return; }
+				matrix.SetCollision((CollisionLayer)a, (CollisionLayer)b, args[2] == "1" || args[2] == "on");
+			}
+			else if (!args.empty()) { Logger::LogWarning("Usage: layer [a] [b] [0/1]"); return; }
+
+			for (int i = 0; i < (int)CollisionLayer::Count; ++i) {
+				std::string row = std::string(Physics::LayerMatrix::GetLayerName((CollisionLayer)i)) + ":";
+				for (int j = 0; j < (int)CollisionLayer::Count; ++j) {
+					if (matrix.CanCollide((CollisionLayer)i, (CollisionLayer)j)) row += std::string(" ") + Physics::LayerMatrix::GetLayerName((CollisionLayer)j);
+				}
+				Logger::Log(row);
+			}
+			});
+
+		// bench_broadphase [count] [frames]: u[htF[YP̂̔r
+		Logger::RegisterCommand("bench_broadphase", [](auto args) {
+			size_t count = args.size() > 0 ? (size_t)std::stoul(args[0]) : 5000;
+			int frames = args.size() > 1 ? std::stoi(args[1]) : 100;
+
+			for (auto type : { Physics::BroadphaseType::Grid, Physics::BroadphaseType::SweepAndPrune, Physics::BroadphaseType::DynamicTree }) {
+				auto r = Physics::RunBroadphaseBenchmark(type, count, frames);
+				Logger::Log(std::string(Physics::GetBroadphaseName(type)) + " x" + std::to_string(count) +
+					": " + std::to_string(r.averageMs) + "ms, " + std::to_string(r.averagePairs) + " pairs");
+			}
+			});
+
+		// bench_narrowphase [count] [maxThreads] [frames]: XJ[ / SIMDAXbhƂ̃i[tF[Y
+		Logger::RegisterCommand("bench_narrowphase", [](auto args) {
+			size_t count = args.size() > 0 ? (size_t)std::stoul(args[0]) : 10000;
+			uint32_t maxThreads = args.size() > 1 ? (uint32_t)std::stoul(args[1]) : 16;
+			int frames = args.size() > 2 ? std::stoi(args[2]) : 20;
+
+			for (const auto& r : CollisionSystem::RunNarrowPhaseBenchmark(count, maxThreads, frames)) {
+				std::string kernel = r.batched ? TransformBatch::GetPathName(TransformBatch::GetBestPath()) : "Scalar";
+				Logger::Log(kernel + " " + std::to_string(r.threads) + " threads x" + std::to_string(count) +
+					": " + std::to_string(r.averageMs) + "ms, " + std::to_string(r.contacts) + " contacts" +
+					(r.matchesReference ? "" : " (MISMATCH)"));
+			}
+			});
+
+		// bench_raycast [agents] [frames]:  / ob`iClosestEAnyj̃CLXg
+		Logger::RegisterCommand("bench_raycast", [](auto args) {
+			size_t agents = args.size() > 0 ? (size_t)std::stoul(args[0]) : 500;
+			int frames = args.size() > 1 ? std::stoi(args[1]) : 20;
+
+			auto r = CollisionSystem::RunRaycastBenchmark(agents, frames);
+			Logger::Log("Raycast x" + std::to_string(r.rays) + " / " + std::to_string(r.colliders) + " colliders" +
+				" BruteForce: " + std::to_string(r.bruteForceMs) + "ms / Closest: " + std::to_string(r.closestMs) +
+				"ms / Any: " + std::to_string(r.anyMs) + "ms (" + std::to_string(r.packetWidth) + " wide)" +
+				(r.matchesReference ? "" : " (MISMATCH)"));
+			});
+
+		// bench_physics [scene / all] [scale] [steps]: `Ȃ̕׏ʁipyramid / rain / bowl / level / meshlevelj̒iKƂ̎
+		Logger::RegisterCommand("bench_physics", [](auto args) {
+			std::string name = args.size() > 0 ? args[0] : "all";
+			float scale = args.size() > 1 ? std::stof(args[1]) : 1.0f;
+			int steps = args.size() > 2 ? std::stoi(args[2]) : 120;
+
+			bool found = false;
+			for (int i = 0; i < (int)Physics::BenchmarkScene::Count; ++i) {
+				auto scene = (Physics::BenchmarkScene)i;
+				if (name != "all" && name != Physics::GetBenchmarkSceneName(scene)) continue;
+				found = true;
+
+				auto r = Physics::RunSceneBenchmark(scene, scale, steps);
+				Logger::Log(std::string(Physics::GetBenchmarkSceneName(scene)) + " x" + std::to_string(r.dynamicBodies) +
+					" (+" + std::to_string(r.staticBodies) + " static) " + std::to_string(r.totalMs) + "ms/step:" +
+					" integrate " + std::to_string(r.integrateMs) + " / hierarchy " + std::to_string(r.hierarchyMs) +
+					" / proxy " + std::to_string(r.proxyMs) + " / broad " + std::to_string(r.broadphaseMs) +
+					" / narrow " + std::to_string(r.narrowPhaseMs) + " / solve " + std::to_string(r.solveMs) +
+					" / other " + std::to_string(r.otherMs));
+				Logger::Log("  contacts avg " + std::to_string((size_t)r.averageContacts) + " max " + std::to_string(r.maxContacts) +
+					", sleeping " + std::to_string(r.sleepingBodies) + ", energy " + std::to_string(r.energyStart) +
+					" -> " + std::to_string(r.energyEnd) + " (max gain " + std::to_string(r.maxEnergyGain) + ")");
+			}
+			if (!found) Logger::LogWarning("Usage: bench_physics [pyramid/rain/bowl/level/meshlevel/all] [scale] [steps]");
+			});
+
+		// check_determinism [count] [maxThreads] [frames]: JԂEi[EXbhςă`FbNTׂ
+		Logger::RegisterCommand("check_determinism", [](auto args) {
+			size_t count = args.size() > 0 ? (size_t)std::stoul(args[0]) : 500;
+			uint32_t maxThreads = args.size() > 1 ? (uint32_t)std::stoul(args[1]) : 8;
+			int frames = args.size() > 2 ? std::stoi(args[2]) : 300;
+
+			auto r = CollisionSystem::RunDeterminismCheck(count, maxThreads, frames);
+			if (r.matches) {
+				Logger::Log("Determinism x" + std::to_string(r.bodies) + " / " + std::to_string(r.frames) + " frames: " +
+					std::to_string(r.runs) + " runs match, checksum " + std::to_string(r.finalChecksum));
+			}
+			else {
+				Logger::LogWarning("Determinism x" + std::to_string(r.bodies) + ": run " + std::to_string(r.mismatchRun) +
+					" differs from frame " + std::to_string(r.firstMismatchFrame));
+			}
+			});
+
+		// check_contacts: @̌₷giSdȂƔȂǁj𔻒肵Ċm߂
+		Logger::RegisterCommand("check_contacts", [](auto args) {
+			auto failures = CollisionSystem::RunContactCheck();
+			if (failures.empty()) { Logger::Log("Contacts: all normals point the expected way"); return; }
+			for (const auto& name : failures) Logger::LogWarning("Contacts: wrong normal in " + name);
+			});
 	}
 }
 
@@ -87,6 +87,7 @@ public:
 			// MY`Ƒ씻
 			if (ImGuizmo::Manipulate(viewM, projM, mCurrentGizmoOperation, ImGuizmo::WORLD, worldM)) {
 				Float16ToTransform(worldM, t);
+				reg.patch<Transform>(selected);
 			}
 		}
 
@@ -85,6 +85,7 @@ private:
 		// q̐ݒ
 		if (!world.getRegistry().has<Relationship>(child)) world.getRegistry().emplace<Relationship>(child);
 		world.getRegistry().get<Relationship>(child).parent = parent;
+		world.getRegistry().patch<Relationship>(child);
 
 		// e̐ݒ
 		if (parent != NullEntity)
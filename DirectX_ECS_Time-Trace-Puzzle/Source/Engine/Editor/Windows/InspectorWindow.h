@@ -28,6 +28,7 @@
 #include "Game/Components/Components.h"
 #include "Engine/Audio/AudioManager.h"
 #include "Engine/Resource/Serializer.h"
+#include "Game/Systems/Physics/LayerMatrix.h"
 #include "imgui.h"
 
 class InspectorWindow : public EditorWindow
@@ -50,7 +51,8 @@ public:
 		char nameBuf[256];
 		strcpy_s(nameBuf, sizeof(nameBuf), tag.name.c_str());
 		if (ImGui::InputText("Name", nameBuf, sizeof(nameBuf))) {
-			tag.name = nameBuf;
+			// OCfbNXXV
+			reg.rename<Tag>(selected, nameBuf);
 		}
 
 		ImGui::Separator();
@@ -63,7 +65,8 @@ public:
 		if (reg.has<Transform>(selected)) {
 			if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen)) {
 				Transform& t = reg.get<Transform>(selected);
-				ImGui::DragFloat3("Position", &t.position.x, 0.1f);
+				bool changed = false;
+				changed |= ImGui::DragFloat3("Position", &t.position.x, 0.1f);
 
 				// ]x@ŕ\EҏW
 				XMFLOAT3 rotDeg;
@@ -74,24 +77,38 @@ public:
 					t.rotation.x = XMConvertToRadians(rotDeg.x);
 					t.rotation.y = XMConvertToRadians(rotDeg.y);
 					t.rotation.z = XMConvertToRadians(rotDeg.z);
+					changed = true;
 				}
 
-				ImGui::DragFloat3("Scale", &t.scale.x, 0.01f);
+				changed |= ImGui::DragFloat3("Scale", &t.scale.x, 0.01f);
+
+				// ÓIȓ蔻̃LbVɕύXm点
+				if (changed) reg.patch<Transform>(selected);
 			}
 		}
 
 		// 2. MeshComponent
-		if (reg.has<MeshComponent>(selected)) {
+		if (reg.has_shared<MeshComponent>(selected)) {
 			if (ImGui::CollapsingHeader("Mesh", ImGuiTreeNodeFlags_DefaultOpen)) {
-				MeshComponent& m = reg.get<MeshComponent>(selected);
+				// LlȂ̂ŃRs[ҏWAύX΂Entitytւ
+				// hbO̓Rs[A1xtւit[̕tւj
+				if (!m_meshEditing || m_meshEditEntity != selected) m_meshEdit = reg.get_shared<MeshComponent>(selected);
+				MeshComponent& m = m_meshEdit;
 
 				// t@CI (ModelstH_)
 				FileSelector("Model", m.modelKey, "Resources/Models", ".fbx"); // .objȂǂ
 
+				bool active = false;
 				ImGui::ColorEdit4("Color", &m.color.x);
+				active |= ImGui::IsItemActive();
 				ImGui::DragFloat3("Scale Offset", &m.scaleOffset.x, 0.01f);
+				active |= ImGui::IsItemActive();
+
+				m_meshEditing = active;
+				m_meshEditEntity = selected;
+				if (!active && m != reg.get_shared<MeshComponent>(selected)) reg.emplace_shared<MeshComponent>(selected, m);
 
-				if (ImGui::Button("Remove Mesh")) reg.remove<MeshComponent>(selected);
+				if (ImGui::Button("Remove Mesh")) reg.remove_shared<MeshComponent>(selected);
 			}
 		}
 
@@ -165,36 +182,63 @@ public:
 		if (reg.has<Collider>(selected)) {
 			if (ImGui::CollapsingHeader("Collider", ImGuiTreeNodeFlags_DefaultOpen)) {
 				Collider& c = reg.get<Collider>(selected);
+				bool changed = false;
 
 				// ^Cv̐؂ւ
-				const char* types[] = { "Box", "Sphere", "Capsule", "Cylinder" };
+				const char* types[] = { "Box", "Sphere", "Capsule", "Cylinder", "Mesh" };
 				int currentType = (int)c.type;
 				if (ImGui::Combo("Type", &currentType, types, IM_ARRAYSIZE(types))) {
 					c.type = (ColliderType)currentType;
+					changed = true;
+				}
+				changed |= ImGui::Checkbox("Is Trigger", &c.isTrigger);
+
+				// C[ƁA鑊̃C[
+				int layer = (int)c.layer;
+				if (ImGui::BeginCombo("Layer", Physics::LayerMatrix::GetLayerName(c.layer))) {
+					for (int i = 0; i < (int)CollisionLayer::Count; ++i) {
+						if (ImGui::Selectable(Physics::LayerMatrix::GetLayerName((CollisionLayer)i), layer == i)) {
+							c.layer = (CollisionLayer)i;
+							changed = true;
+						}
+					}
+					ImGui::EndCombo();
+				}
+				if (ImGui::TreeNode("Collision Mask")) {
+					for (int i = 0; i < (int)CollisionLayer::Count; ++i) {
+						changed |= ImGui::CheckboxFlags(Physics::LayerMatrix::GetLayerName((CollisionLayer)i), &c.mask, LayerBit((CollisionLayer)i));
+					}
+					ImGui::TreePop();
 				}
-				ImGui::Checkbox("Is Trigger", &c.isTrigger);
 
-				ImGui::DragFloat3("Offset", &c.offset.x, 0.01f);
+				changed |= ImGui::DragFloat3("Offset", &c.offset.x, 0.01f);
 
 				// ^CvƂ̃p[^
 				if (c.type == ColliderType::Box)
 				{
-					ImGui::DragFloat3("Size", &c.boxSize.x, 0.01f);
+					changed |= ImGui::DragFloat3("Size", &c.boxSize.x, 0.01f);
 				}
 				else if (c.type == ColliderType::Sphere)
 				{
-					ImGui::DragFloat("Radius", &c.sphere.radius, 0.01f);
+					changed |= ImGui::DragFloat("Radius", &c.sphere.radius, 0.01f);
 				}
 				else if (c.type == ColliderType::Capsule)
 				{
-					ImGui::DragFloat("Radius", &c.capsule.radius, 0.01f);
-					ImGui::DragFloat("Height", &c.capsule.height, 0.01f);
+					changed |= ImGui::DragFloat("Radius", &c.capsule.radius, 0.01f);
+					changed |= ImGui::DragFloat("Height", &c.capsule.height, 0.01f);
 				}
 				else if (c.type == ColliderType::Cylinder)
 				{
-					ImGui::DragFloat("Radius", &c.cylinder.radius, 0.01f);
-					ImGui::DragFloat("Height", &c.cylinder.height, 0.01f);
+					changed |= ImGui::DragFloat("Radius", &c.cylinder.radius, 0.01f);
+					changed |= ImGui::DragFloat("Height", &c.cylinder.height, 0.01f);
+				}
+				else if (c.type == ColliderType::Mesh)
+				{
+					std::string key = c.meshKey;
+					FileSelector("Model", c.meshKey, "Resources/Models", ".fbx");
+					changed |= (key != c.meshKey);
 				}
+				if (changed) reg.patch<Collider>(selected);
 
 				if (ImGui::Button("Remove Collider")) reg.remove<Collider>(selected);
 			}
@@ -210,11 +254,18 @@ public:
 				int current = (int)rb.type;
 				if (ImGui::Combo("Body Type", &current, types, IM_ARRAYSIZE(types))) {
 					rb.type = (BodyType)current;
+					reg.patch<Rigidbody>(selected);	// Static Ƃ̐؂ւŐÓIBVHς
 				}
 
 				ImGui::DragFloat("Mass", &rb.mass, 0.1f);
 				ImGui::DragFloat("Drag", &rb.drag, 0.01f);
 				ImGui::Checkbox("Use Gravity", &rb.useGravity);
+				ImGui::Checkbox("Continuous", &rb.continuous);
+				ImGui::Text("Sleeping: %s", rb.isSleeping ? "Yes" : "No");
+				if (rb.isSleeping) {
+					ImGui::SameLine();
+					if (ImGui::Button("Wake")) rb.isSleeping = false;	// ̎c CollisionSystem N
+				}
 				if (ImGui::Button("Stop")) rb.velocity = { 0,0,0 };
 				if (ImGui::Button("Remove")) reg.remove<Rigidbody>(selected);
 			}
@@ -246,7 +297,7 @@ public:
 
 		if (ImGui::BeginPopup("AddComponentPopup")) {
 			// ɑSẴR|[lgǉ
-			if (!reg.has<MeshComponent>(selected) && ImGui::Selectable("Mesh")) reg.emplace<MeshComponent>(selected, "hero");
+			if (!reg.has_shared<MeshComponent>(selected) && ImGui::Selectable("Mesh")) reg.emplace_shared<MeshComponent>(selected, "hero");
 			if (!reg.has<SpriteComponent>(selected) && ImGui::Selectable("Sprite")) reg.emplace<SpriteComponent>(selected, "player", 100, 100);
 			if (!reg.has<BillboardComponent>(selected) && ImGui::Selectable("Billboard")) reg.emplace<BillboardComponent>(selected, "star");
 			if (!reg.has<Collider>(selected) && ImGui::Selectable("Collider")) reg.emplace<Collider>(selected);
@@ -281,6 +332,11 @@ public:
 	}
 
 private:
+	// ҏW̋L MeshComponent ̃Rs[ihbO𗣂܂ŕtւȂj
+	MeshComponent m_meshEdit;
+	Entity m_meshEditEntity = NullEntity;
+	bool m_meshEditing = false;
+
 	// --------------------------------------------------------
 	// t@CIwp[ifBNg𑖍ăR{{bNX\j
 	// --------------------------------------------------------
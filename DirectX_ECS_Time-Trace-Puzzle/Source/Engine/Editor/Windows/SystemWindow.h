@@ -291,23 +291,20 @@ public:
 		// --------------------------------------------------------
 		if (ImGui::CollapsingHeader("Player Watcher", ImGuiTreeNodeFlags_DefaultOpen))
 		{
-			bool playerFound = false;
-			reg.view<Tag>([&](Entity e, Tag& tag) {
-				if (!playerFound && tag.name == "Player") {
-					playerFound = true;
-
-					ImGui::Text("ID: %d", e);
-					if (reg.has<Transform>(e)) {
-						auto& t = reg.get<Transform>(e);
-						ImGui::Text("Pos: (%.2f, %.2f, %.2f)", t.position.x, t.position.y, t.position.z);
-					}
-					if (reg.has<Rigidbody>(e)) {
-						auto& rb = reg.get<Rigidbody>(e);
-						float speed = std::sqrt(rb.velocity.x * rb.velocity.x + rb.velocity.z * rb.velocity.z);
-						ImGui::ProgressBar(speed / 10.0f, ImVec2(0, 0), "Speed");
-					}
+			Entity e = reg.find_by_name<Tag>("Player");
+			bool playerFound = (e != NullEntity);
+			if (playerFound) {
+				ImGui::Text("ID: %d", e);
+				if (reg.has<Transform>(e)) {
+					auto& t = reg.get<Transform>(e);
+					ImGui::Text("Pos: (%.2f, %.2f, %.2f)", t.position.x, t.position.y, t.position.z);
 				}
-				});
+				if (reg.has<Rigidbody>(e)) {
+					auto& rb = reg.get<Rigidbody>(e);
+					float speed = std::sqrt(rb.velocity.x * rb.velocity.x + rb.velocity.z * rb.velocity.z);
+					ImGui::ProgressBar(speed / 10.0f, ImVec2(0, 0), "Speed");
+				}
+			}
 
 			if (!playerFound) ImGui::TextDisabled("Player Not Found");
 		}
@@ -318,9 +315,10 @@ public:
 		if (ctx.debug.useDebugCamera)
 		{
 			// MainCameraT
-			reg.view<Tag, Transform, Camera>([&](Entity e, Tag& tag, Transform& t, Camera& c) {
-				if (tag.name == "MainCamera")
+			for (Entity e : reg.find_all_by_name<Tag>("MainCamera")) {
+				if (reg.has<Transform>(e) && reg.has<Camera>(e))
 				{
+					Transform& t = reg.get<Transform>(e);
 					bool isRightClicking = Input::GetMouseRightButton();
 
 					// ImGui쒆͓Ȃ
@@ -356,7 +354,7 @@ public:
 						XMStoreFloat3(&t.position, pos);
 					}
 				}
-				});
+			}
 		}
 
 		ImGui::End();
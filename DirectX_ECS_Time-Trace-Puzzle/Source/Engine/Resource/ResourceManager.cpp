@@ -88,6 +88,7 @@ void ResourceManager::LoadManifest(const std::string& jsonPath) {
 				// pXo^
 				m_modelPaths[key] = path;
 			}
+			++m_modelRevision;
 		}
 		// "sounds" ZNVǂݍ
 		if (j.contains("sounds")) {
@@ -157,6 +158,62 @@ std::shared_ptr<Model> ResourceManager::GetModel(const std::string& key)
 	return LoadModelFromFile(filepath);
 }
 
+bool ResourceManager::LoadCollisionMesh(const std::string& key, std::vector<DirectX::XMFLOAT3>& outPositions, std::vector<uint32_t>& outIndices)
+{
+	outPositions.clear();
+	outIndices.clear();
+
+	auto itPath = m_modelPaths.find(key);
+	if (itPath == m_modelPaths.end()) return false;
+
+	// `pƓtOœǂށi_̏ԁEWn𑵂j
+	Assimp::Importer importer;
+	const aiScene* scene = importer.ReadFile(
+		itPath->second,
+		aiProcess_Triangulate |
+		aiProcess_ConvertToLeftHanded
+	);
+
+	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
+	{
+		OutputDebugStringA(("Assimp Error: " + std::string(importer.GetErrorString()) + "\n").c_str());
+		return false;
+	}
+
+	// ProcessNode ƓɃbVHA1ɂ܂Ƃ߂im[h̍s͊|Ȃj
+	std::vector<const aiNode*> nodes = { scene->mRootNode };
+	while (!nodes.empty())
+	{
+		const aiNode* node = nodes.back();
+		nodes.pop_back();
+
+		for (unsigned int i = 0; i < node->mNumMeshes; i++)
+		{
+			const aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
+			const uint32_t base = static_cast<uint32_t>(outPositions.size());
+
+			for (unsigned int v = 0; v < mesh->mNumVertices; v++) {
+				outPositions.push_back({ mesh->mVertices[v].x, mesh->mVertices[v].y, mesh->mVertices[v].z });
+			}
+			for (unsigned int f = 0; f < mesh->mNumFaces; f++) {
+				// Op`Ă_E͎ĉŎ̂Ăiƈȍ~3̋؂肪j
+				const aiFace& face = mesh->mFaces[f];
+				if (face.mNumIndices != 3) continue;
+				for (unsigned int j = 0; j < 3; j++) {
+					outIndices.push_back(base + face.mIndices[j]);
+				}
+			}
+		}
+		// q͋tɐςށi擪̎q珈j
+		for (unsigned int i = node->mNumChildren; i > 0; i--)
+		{
+			nodes.push_back(node->mChildren[i - 1]);
+		}
+	}
+
+	return !outIndices.empty();
+}
+
 std::shared_ptr<Sound> ResourceManager::GetSound(const std::string& key)
 {
 	// 1. L[o^`FbN
@@ -243,6 +300,7 @@ std::shared_ptr<Model> ResourceManager::LoadModelFromFile(const std::string& fil
 	ProcessNode(scene->mRootNode, scene, model, directory);
 
 	m_models[filepath] = model;
+	++m_modelRevision;
 	return model;
 }
 
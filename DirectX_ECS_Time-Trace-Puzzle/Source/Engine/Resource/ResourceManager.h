@@ -24,6 +24,8 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
+#include <cstdint>
 #include <d3d11.h>
 #include "Engine/Graphics/Core/Texture.h"
 #include "Engine/Graphics/Core/Model.h"
@@ -59,6 +61,13 @@ public:
 	// 擾
 	std::shared_ptr<Sound> GetSound(const std::string& key);
 
+	// 蔻p̎Op`iSbV̈ʒuƃCfbNXjt@Cǂ
+	// `p Model ɂ͎cȂ̂ŁAMeshCollider gf̕ǂݍ܂
+	bool LoadCollisionMesh(const std::string& key, std::vector<DirectX::XMFLOAT3>& outPositions, std::vector<uint32_t>& outIndices);
+
+	// f̃pX̓o^Ef̓ǂݍ݂̂тɑiǂ߂Ȃfǂݒ̔fpj
+	uint64_t GetModelRevision() const { return m_modelRevision; }
+
 	// fobO`
 	void OnInspector();
 
@@ -84,6 +93,7 @@ private:
 	// fpLbV
 	std::map<std::string, std::string> m_modelPaths;
 	std::map<std::string, std::shared_ptr<Model>> m_models;
+	uint64_t m_modelRevision = 0;
 
 	// TEhpLbV
 	std::map<std::string, std::string> m_soundPaths;
@@ -27,6 +27,7 @@
 // ===== CN[h =====
 #include "Engine/ECS/ECS.h"
 #include "Game/Components/Components.h"
+#include "Game/Systems/Physics/LayerMatrix.h"
 #include <json.hpp>
 #include <fstream>
 #include <string>
@@ -46,7 +47,7 @@ public:
 		SerializeComponent<Camera>(registry, entity, j, "Camera");
 
 		// _On
-		SerializeComponent<MeshComponent>(registry, entity, j, "MeshComponent");
+		SerializeSharedComponent<MeshComponent>(registry, entity, j, "MeshComponent");
 		SerializeComponent<SpriteComponent>(registry, entity, j, "SpriteComponent");
 		SerializeComponent<BillboardComponent>(registry, entity, j, "BillboardComponent");
 
@@ -81,7 +82,7 @@ public:
 		DeserializeComponent<Transform>(reg, e, j, "Transform");
 		DeserializeComponent<Camera>(reg, e, j, "Camera");
 
-		DeserializeComponent<MeshComponent>(reg, e, j, "MeshComponent");
+		DeserializeSharedComponent<MeshComponent>(reg, e, j, "MeshComponent");
 		DeserializeComponent<SpriteComponent>(reg, e, j, "SpriteComponent");
 		DeserializeComponent<BillboardComponent>(reg, e, j, "BillboardComponent");
 
@@ -118,6 +119,24 @@ private:
 		}
 	}
 
+	// ۑpiLR|[lgj
+	template<typename T>
+	static void SerializeSharedComponent(Registry& reg, Entity e, json& j, const std::string& key) {
+		if (reg.has_shared<T>(e)) {
+			j[key] = ToJson(reg.get_shared<T>(e));
+		}
+	}
+
+	// ǂݍݗpiLR|[lgj
+	template<typename T>
+	static void DeserializeSharedComponent(Registry& reg, Entity e, const json& j, const std::string& key) {
+		if (j.contains(key)) {
+			T comp;
+			FromJson(j[key], comp);
+			reg.emplace_shared<T>(e, comp);
+		}
+	}
+
 	// --- eR|[lg̕ϊ` (ToJson / FromJson) ---
 
 	// Tag
@@ -193,7 +212,8 @@ private:
 		return {
 			{"type", (int)c.type},	// enumintŕۑ
 			{"vel", {c.velocity.x, c.velocity.y, c.velocity.z}},
-			{"mass", c.mass}, {"drag", c.drag}, {"grav", c.useGravity}
+			{"mass", c.mass}, {"drag", c.drag}, {"grav", c.useGravity},
+			{"ccd", c.continuous}
 		};
 	}
 	static void FromJson(const json& j, Rigidbody& c) {
@@ -201,6 +221,7 @@ private:
 		if (j.contains("vel")) { auto v = j["vel"]; c.velocity = { v[0], v[1], v[2] }; }
 		c.mass = j["mass"]; c.drag = j["drag"];
 		c.useGravity = j["grav"];
+		if (j.contains("ccd")) c.continuous = j["ccd"];
 	}
 
 	// Collider
@@ -219,7 +240,12 @@ private:
 			j["radius"] = c.capsule.radius;
 			j["height"] = c.capsule.height;
 		}
+		else if (c.type == ColliderType::Mesh) {
+			j["mesh"] = c.meshKey;
+		}
 		j["isTrigger"] = c.isTrigger;
+		j["layer"] = (int)c.layer;
+		j["mask"] = c.mask;
 		return j;
 	}
 	static void FromJson(const json& j, Collider& c) {
@@ -234,7 +260,14 @@ private:
 			c.capsule.radius = j["radius"];
 			c.capsule.height = j["height"];
 		}
+		if (j.contains("mesh")) c.meshKey = j["mesh"].get<std::string>();
 		if (j.contains("isTrigger")) c.isTrigger = j["isTrigger"];
+		if (j.contains("layer")) {
+			// ͈͊Oiꂽt@CȂǁj Default ɖ߂iLayerBit  LayerMatrix ̕\zȂ悤Ɂj
+			int layer = j["layer"].get<int>();
+			c.layer = (layer >= 0 && layer < Physics::LayerMatrix::MaxLayers) ? (CollisionLayer)layer : CollisionLayer::Default;
+		}
+		if (j.contains("mask")) c.mask = j["mask"];
 	}
 
 	// PlayerInput
@@ -22,6 +22,8 @@
 
 // ===== CN[h =====
 #include <DirectXMath.h>
+#include <functional>
+#include <string>
 #include "main.h"
 
 using namespace DirectX;
@@ -54,8 +56,15 @@ struct Transform
 	// [hs
 	DirectX::XMMATRIX worldMatrix;
 
+	// [hԂł̈ʒuE]EXP[iHierarchySystemsƓɏށj
+	// Փ˔ȂǂŖt[ XMMatrixDecompose Ȃ߂̃LbV
+	XMFLOAT3 worldPosition;
+	XMFLOAT4 worldRotation;	// NH[^jI
+	XMFLOAT3 worldScale;
+
 	Transform(XMFLOAT3 p = { 0.0f, 0.0f, 0.0f }, XMFLOAT3 r = { 0.0f, 0.0f, 0.0f }, XMFLOAT3 s = { 1.0f, 1.0f, 1.0f })
 		: position(p), rotation(r), scale(s)
+		, worldPosition({ 0.0f, 0.0f, 0.0f }), worldRotation({ 0.0f, 0.0f, 0.0f, 1.0f }), worldScale({ 1.0f, 1.0f, 1.0f })
 	{
 		worldMatrix = DirectX::XMMatrixIdentity();
 	}
@@ -111,9 +120,15 @@ struct Rigidbody
 	float drag;
 	bool useGravity;
 	bool freezeRotation;	// ]Œ肷邩
+	bool continuous;		// AiĂǂ蔲ȂB傫ɔׂđ鎞͎w肵ȂĂsjB͐ÓIȓ蔻肾
+
+	// is̏ԁBۑȂj
+	bool isSleeping;		// ĂԂ͐ϕE蔻E\o[O
+	float sleepTime;		// x臒l菬ԂĂ鎞
 
 	Rigidbody(BodyType t = BodyType::Dynamic, float m = 1.0f)
-		: type(t), velocity({ 0,0,0 }), mass(m), drag(0.1f), useGravity(true), freezeRotation(true)
+		: type(t), velocity({ 0,0,0 }), mass(m), drag(0.1f), useGravity(true), freezeRotation(true), continuous(false),
+		isSleeping(false), sleepTime(0.0f)
 	{
 		// StaticKinematicȂdOFFɂȂǂ̏
 		if (type != BodyType::Dynamic) useGravity = false;
@@ -130,8 +145,28 @@ enum class ColliderType
 	Sphere,		// 
 	Capsule,	// JvZ
 	Cylinder,	// ~
+	Mesh,		// Op`bVif̎Op`Bn`EȂǂ̓Ȃ̗pj
 };
 
+/**
+ * @enum	CollisionLayer
+ * @brief	蔻̃C[i0 ` 31Bgݍ킹Ƃ̉ۂ Physics::LayerMatrix Ō߂j
+ */
+enum class CollisionLayer : uint8_t
+{
+	Default = 0,
+	Player,
+	Ghost,		// vC̎c
+	Sensor,		// XCb`EȂǂ̌op
+	Debris,		// jЂȂǌڂ̂
+	UI,			// CLXg̑Ώۂ
+
+	Count,		// Ot̃C[̐
+};
+
+// C[̃rbgiCollider::mask pj
+constexpr uint32_t LayerBit(CollisionLayer layer) { return 1u << (uint32_t)layer; }
+
 /**
  * @struct	Collider
  * @brief	蔻
@@ -140,6 +175,8 @@ struct Collider
 {
 	ColliderType type;
 	bool isTrigger;
+	CollisionLayer layer;	// ̃C[
+	uint32_t mask;			// 鑊̃C[iLayerBit ̑gݍ킹jB݂̃}XNɑ肪Ă鎞肷
 
 	// p̂Ńߖ
 	union
@@ -152,8 +189,11 @@ struct Collider
 
 	XMFLOAT3 offset;
 
+	// type == Mesh ̎̃f̃L[iResourceManagerjBOp` BVH ̓fƂ1ċL
+	std::string meshKey;
+
 	// RXgN^
-	Collider() : type(ColliderType::Box), isTrigger(false), offset({ 0,0,0 }) { boxSize = { 1,1,1 }; }
+	Collider() : type(ColliderType::Box), isTrigger(false), layer(CollisionLayer::Default), mask(0xFFFFFFFFu), offset({ 0,0,0 }) { boxSize = { 1,1,1 }; }
 
 	// wp[֐
 	static Collider CreateSphere(float r)
@@ -172,6 +212,10 @@ struct Collider
 	{
 		Collider c; c.type = ColliderType::Cylinder; c.cylinder.radius = r; c.cylinder.height = h; return c;
 	}
+	static Collider CreateMesh(const std::string& modelKey)
+	{
+		Collider c; c.type = ColliderType::Mesh; c.meshKey = modelKey; return c;
+	}
 };
 
 // ============================================================
@@ -197,6 +241,7 @@ struct PlayerInput
 /**
  * @struct	MeshComponent
  * @brief	f`
+ * @note	LR|[lgiregistry.emplace_shared / add_sharedjƂĎg܂
  */
 struct MeshComponent
 {
@@ -211,8 +256,33 @@ struct MeshComponent
 		const XMFLOAT4& c = { 1.0f, 1.0f, 1.0f, 1.0f })
 		: modelKey(key), scaleOffset(scale), color(c) {
 	}
+
+	// Ll̏dp
+	bool operator==(const MeshComponent& o) const
+	{
+		return	modelKey == o.modelKey &&
+			scaleOffset.x == o.scaleOffset.x && scaleOffset.y == o.scaleOffset.y && scaleOffset.z == o.scaleOffset.z &&
+			color.x == o.color.x && color.y == o.color.y && color.z == o.color.z && color.w == o.color.w;
+	}
+	bool operator!=(const MeshComponent& o) const { return !(*this == o); }
 };
 
+// LľpiSharedSetj
+namespace std
+{
+	template<>
+	struct hash<MeshComponent>
+	{
+		size_t operator()(const MeshComponent& m) const
+		{
+			size_t h = hash<string>{}(m.modelKey);
+			const float values[7] = { m.scaleOffset.x, m.scaleOffset.y, m.scaleOffset.z, m.color.x, m.color.y, m.color.z, m.color.w };
+			for (float v : values) h = h * 31 + hash<float>{}(v);
+			return h;
+		}
+	};
+}
+
 /**
  * @struct	SpriteComponent
  * @brief	2D`
@@ -86,7 +86,7 @@ void SceneGame::Initialize()
 		.add<Rigidbody>(BodyType::Dynamic)
 		.add<Collider>()
 		.add<PlayerInput>()
-		.add<MeshComponent>("hero", XMFLOAT3(0.1f, 0.1f, 0.1f));
+		.add_shared<MeshComponent>("hero", XMFLOAT3(0.1f, 0.1f, 0.1f));
 
 	// Enemy
 	m_world.create_entity()
@@ -114,16 +114,16 @@ void SceneGame::Update()
 
 	if (Input::GetButtonDown(Button::A))
 	{
-		XMFLOAT3 playerPos = { 0, 0, 0 };
-		m_world.getRegistry().view<Tag, Transform>([&](Entity e, Tag& tag, Transform& t)
-			{
-				if (tag.name == "Player")
-				{
-					Prefab::CreateSoundEffect(m_world, "jump", t.position, 1.0f, 30.0f);
+		Registry& reg = m_world.getRegistry();
+		Entity player = reg.find_by_name<Tag>("Player");
+		if (player != NullEntity && reg.has<Transform>(player))
+		{
+			// Ńv[LтƎQƂɂȂ̂ŃRs[Ă
+			XMFLOAT3 playerPos = reg.get<Transform>(player).position;
+			Prefab::CreateSoundEffect(m_world, "jump", playerPos, 1.0f, 30.0f);
 
-					Logger::Log("Spawned Jump Sound!");
-				}
-			});
+			Logger::Log("Spawned Jump Sound!");
+		}
 	}
 }
 
@@ -65,20 +65,25 @@ public:
 		m_renderer->Begin(viewMatrix, projMatrix, lightDir);
 
 		// 3. MeshComponentTransformEntity`
-		registry.view<MeshComponent, Transform>([&](Entity e, MeshComponent& m, Transform& t)
+		// fݒgEntityƂɂ܂Ƃ߂ĕ`悷if̌̓O[vƂ1j
+		registry.view_shared<MeshComponent>([&](const MeshComponent& m, Span<const Entity> entities)
 			{
 				auto model = ResourceManager::Instance().GetModel(m.modelKey);
-				if (model)
+				if (!model) return;
+
+				// fŗL̃XP[␳
+				bool hasPreScale = (m.scaleOffset.x != 1.0f || m.scaleOffset.y != 1.0f || m.scaleOffset.z != 1.0f);
+				XMMATRIX preScale = XMMatrixScaling(m.scaleOffset.x, m.scaleOffset.y, m.scaleOffset.z);
+
+				for (Entity e : entities)
 				{
+					if (!registry.has<Transform>(e)) continue;
+
 					// vZς݂ worldMatrix 擾
-					XMMATRIX world = t.worldMatrix;
+					XMMATRIX world = registry.get<Transform>(e).worldMatrix;
 
 					// fŗL̃XP[␳ * Transform̃XP[
-					if (m.scaleOffset.x != 1.0f || m.scaleOffset.y != 1.0f || m.scaleOffset.z != 1.0f)
-					{
-						XMMATRIX preScale = XMMatrixScaling(m.scaleOffset.x, m.scaleOffset.y, m.scaleOffset.z);
-						world = preScale * world;
-					}
+					if (hasPreScale) world = preScale * world;
 
 					// `
 					m_renderer->Draw(model, world);
@@ -23,6 +23,7 @@
 #include "Engine/Audio/AudioManager.h"
 #include "Engine/Graphics/Renderers/SpriteRenderer.h"
 #include "Engine/Graphics/Renderers/BillboardRenderer.h"
+#include "Game/Systems/Physics/TriangleMesh.h"
 
 using namespace DirectX;
 
@@ -85,16 +86,10 @@ void RenderSystem::Render(Registry& registry, const Context& context)
 					if (name == "Enemy") color = { 1.0f, 0.0f, 0.0f, 1.0f };
 				}
 
-				// [hWvZ
-				XMVECTOR scale, rot, pos;
-				XMMatrixDecompose(&scale, &rot, &pos, t.worldMatrix);
+				// [hԂ̉]EXP[iHierarchySystemŃLbVς݁j
+				const XMFLOAT3& gScale = t.worldScale;
+				const XMFLOAT4& gRot = t.worldRotation;
 
-				XMFLOAT3 gPos, gScale;
-				XMStoreFloat3(&gPos, pos);
-				XMStoreFloat3(&gScale, scale);
-				XMFLOAT4 gRot;
-				XMStoreFloat4(&gRot, rot);
-				
 				// ItZbg^p
 				XMVECTOR offsetVec = XMLoadFloat3(&c.offset);
 				XMVECTOR centerVec = XMVector3Transform(offsetVec, t.worldMatrix);
@@ -122,6 +117,16 @@ void RenderSystem::Render(Registry& registry, const Context& context)
 					float maxScaleXZ = std::max(gScale.x, gScale.z);
 					m_renderer->DrawCylinder(center, c.cylinder.radius * maxScaleXZ, c.cylinder.height * gScale.y, gRot, color);
 				}
+				else if (c.type == ColliderType::Mesh) {
+					// Op`͕`AfԂAABB]ŕ\
+					if (const Physics::TriangleMesh* mesh = Physics::TriangleMeshLibrary::Instance().Get(c.meshKey)) {
+						const Physics::AABB& b = mesh->GetBounds();
+						XMFLOAT3 local = { (b.min.x + b.max.x) * 0.5f + c.offset.x, (b.min.y + b.max.y) * 0.5f + c.offset.y, (b.min.z + b.max.z) * 0.5f + c.offset.z };
+						XMFLOAT3 boundsCenter; XMStoreFloat3(&boundsCenter, XMVector3Transform(XMLoadFloat3(&local), t.worldMatrix));
+						XMFLOAT3 size = { (b.max.x - b.min.x) * gScale.x, (b.max.y - b.min.y) * gScale.y, (b.max.z - b.min.z) * gScale.z };
+						m_renderer->DrawBox(boundsCenter, size, gRot, color);
+					}
+				}
 			});
 	}
 
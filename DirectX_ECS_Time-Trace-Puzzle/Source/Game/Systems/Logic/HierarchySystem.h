@@ -23,7 +23,9 @@
 // ===== CN[h =====
 #include "Engine/ECS/ECS.h"
 #include "Game/Components/Components.h"
-#include <functional>
+#include "Game/Systems/Logic/TransformBatch.h"
+#include <vector>
+#include <cstring>
 
 class HierarchySystem
 	: public ISystem
@@ -33,33 +35,12 @@ public:
 
 	void Update(Registry& registry) override
 	{
-		// ċAIɍsXV֐
-		std::function<void(Entity, const DirectX::XMMATRIX&)> updateMatrix =
-			[&](Entity entity, const DirectX::XMMATRIX& parentMatrix)
-			{
-				if (registry.has<Transform>(entity)) {
-					auto& t = registry.get<Transform>(entity);
-
-					// 1. [Js (S * R * T)
-					DirectX::XMMATRIX localMat =
-						DirectX::XMMatrixScaling(t.scale.x, t.scale.y, t.scale.z) *
-						DirectX::XMMatrixRotationRollPitchYaw(t.rotation.x, t.rotation.y, t.rotation.z) *
-						DirectX::XMMatrixTranslation(t.position.x, t.position.y, t.position.z);
-
-					// 2. e̍s|ă[hsɂ
-					// ʂ Transform g worldMatrix ɕۑI
-					t.worldMatrix = localMat * parentMatrix;
-
-					// 3. qɂ̃[hsnčXV
-					if (registry.has<Relationship>(entity)) {
-						for (Entity child : registry.get<Relationship>(entity).children) {
-							updateMatrix(child, t.worldMatrix);
-						}
-					}
-				}
-			};
+		// e -> q̏ɁA[̃GeBeB܂Ƃ߂ČvZ
+		// ii̒ł݂͌ɈˑȂ̂ŁASIMDł܂Ƃ߂ďłj
+		m_current.clear();
+		m_currentParents.clear();
 
-		// --- [gieȂjGeBeBTčXVJn ---
+		// --- [gieȂjGeBeBW߂ ---
 		registry.view<Transform>([&](Entity e, Transform& t) {
 			bool isRoot = true;
 			if (registry.has<Relationship>(e)) {
@@ -67,11 +48,70 @@ public:
 			}
 
 			if (isRoot) {
-				// [g̐es͒Pʍs
-				updateMatrix(e, DirectX::XMMatrixIdentity());
+				// [g̐e͖iPʍs񈵂j
+				m_current.push_back(e);
+				m_currentParents.push_back(nullptr);
+
+				// [J̈ʒuE]EXP[OƈႦ΁A[hs񂪕ςƈt
+				// iÓIȓ蔻肪 patch œꂽ̂ASׂɌ邽߁j
+				if (m_rootPoses.size() <= e) m_rootPoses.resize((size_t)e + 1);
+				RootPose& pose = m_rootPoses[e];
+				if (!pose.known || std::memcmp(&pose.position, &t.position, sizeof(XMFLOAT3) * 3) != 0) {
+					std::memcpy(&pose.position, &t.position, sizeof(XMFLOAT3) * 3);
+					pose.known = true;
+					registry.mark<Transform>(e);
+				}
 			}
 			});
+
+		while (!m_current.empty())
+		{
+			// 1. ̒ĩ[hs܂Ƃ߂ČvZ
+			m_transforms.clear();
+			for (Entity e : m_current) m_transforms.push_back(&registry.get<Transform>(e));
+			TransformBatch::ComposeWorld(m_transforms.data(), m_currentParents.data(), m_transforms.size());
+
+			// 2. ̒iiqjW߂
+			m_next.clear();
+			m_nextParents.clear();
+			for (size_t i = 0; i < m_current.size(); ++i)
+			{
+				Entity entity = m_current[i];
+				if (!registry.has<Relationship>(entity)) continue;
+
+				for (Entity child : registry.get<Relationship>(entity).children) {
+					if (registry.has<Transform>(child)) {
+						m_next.push_back(child);
+						m_nextParents.push_back(m_transforms[i]);
+					}
+				}
+			}
+
+			m_current.swap(m_next);
+			m_currentParents.swap(m_nextParents);
+		}
 	}
+
+private:
+	/**
+	 * @struct	RootPose
+	 * @brief	[g̑Õ[J̈ʒuE]EXP[iTransform Ɠсj
+	 */
+	struct RootPose
+	{
+		XMFLOAT3 position;
+		XMFLOAT3 rotation;
+		XMFLOAT3 scale;
+		bool known = false;
+	};
+	std::vector<RootPose> m_rootPoses;	// Entity ID -> O̒l
+
+	// t[̊mۂ邽ߎg
+	std::vector<Entity> m_current;
+	std::vector<Entity> m_next;
+	std::vector<const Transform*> m_currentParents;
+	std::vector<const Transform*> m_nextParents;
+	std::vector<Transform*> m_transforms;
 };
 
 #endif // !___HIERARCHY_SYSTEM_H___
\ No newline at end of file
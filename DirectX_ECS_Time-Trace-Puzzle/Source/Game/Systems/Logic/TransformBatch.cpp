@@ -0,0 +1,430 @@
+/*****************************************************************//**
+ * @file	TransformBatch.cpp
+ * @brief	Transform̃[hs܂Ƃ߂ČvZob`J[l
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Logic/TransformBatch.h"
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+// x64 / SSE2Lx86 ̂SIMDoHrh
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRANSFORM_BATCH_SIMD 1
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#define TRANSFORM_BATCH_SIMD 0
+#endif
+
+using namespace DirectX;
+
+namespace
+{
+	// =================================================================
+	// XJ[ŁiDirectXMath1j
+	// =================================================================
+	void ComposeScalar(Transform& t, const Transform* parent)
+	{
+		// 1. [Js (S * R * T)
+		// ]̓NH[^jIx߁AsƃLbV̗Ɏg
+		XMVECTOR localRot = XMQuaternionRotationRollPitchYaw(t.rotation.x, t.rotation.y, t.rotation.z);
+		XMMATRIX localMat =
+			XMMatrixScaling(t.scale.x, t.scale.y, t.scale.z) *
+			XMMatrixRotationQuaternion(localRot) *
+			XMMatrixTranslation(t.position.x, t.position.y, t.position.z);
+
+		// 2. e̍s|ă[hsɂ
+		// elXP[Ŏq]ĂꍇifjAworldScale ͋ߎlɂȂ
+		if (parent) {
+			t.worldMatrix = localMat * parent->worldMatrix;
+			XMVECTOR parentRot = XMLoadFloat4(&parent->worldRotation);
+			XMStoreFloat4(&t.worldRotation, XMQuaternionMultiply(localRot, parentRot));
+			t.worldScale = {
+				t.scale.x * parent->worldScale.x,
+				t.scale.y * parent->worldScale.y,
+				t.scale.z * parent->worldScale.z
+			};
+		}
+		else {
+			t.worldMatrix = localMat;
+			XMStoreFloat4(&t.worldRotation, localRot);
+			t.worldScale = t.scale;
+		}
+		XMStoreFloat3(&t.worldPosition, t.worldMatrix.r[3]);
+	}
+
+#if TRANSFORM_BATCH_SIMD
+	// =================================================================
+	// [Ƃ̉Zbp[iJ[l{̂̓ev[gŋʉj
+	// =================================================================
+	struct LaneSSE
+	{
+		using V = __m128;
+		static constexpr size_t Width = 4;
+
+		static V Load(const float* p) { return _mm_load_ps(p); }
+		static void Store(float* p, V v) { _mm_store_ps(p, v); }
+		static V Set(float s) { return _mm_set1_ps(s); }
+		static V Add(V a, V b) { return _mm_add_ps(a, b); }
+		static V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+		static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+		// int32 ւ̕ϊ͔͈͊O 0x80000000 ɂȂ̂ŁAfloat ̂܂ }2^23 𑫂Ĉ
+		// i|a| >= 2^23 ͊ɐȂ̂ł̂܂܁j
+		static V Round(V a)
+		{
+			const V big = _mm_set1_ps(8388608.0f);
+			V magic = _mm_or_ps(big, SignBit(a));
+			V rounded = _mm_sub_ps(_mm_add_ps(a, magic), magic);
+			return Select(Greater(big, Abs(a)), rounded, a);
+		}
+		static V Abs(V a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		static V SignBit(V a) { return _mm_and_ps(_mm_set1_ps(-0.0f), a); }
+		static V Or(V a, V b) { return _mm_or_ps(a, b); }
+		static V Greater(V a, V b) { return _mm_cmpgt_ps(a, b); }
+		// mask ? a : b
+		static V Select(V mask, V a, V b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+	};
+
+	struct LaneAVX2
+	{
+		using V = __m256;
+		static constexpr size_t Width = 8;
+
+		static V Load(const float* p) { return _mm256_load_ps(p); }
+		static void Store(float* p, V v) { _mm256_store_ps(p, v); }
+		static V Set(float s) { return _mm256_set1_ps(s); }
+		static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+		static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+		static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+		static V Round(V a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static V Abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		static V SignBit(V a) { return _mm256_and_ps(_mm256_set1_ps(-0.0f), a); }
+		static V Or(V a, V b) { return _mm256_or_ps(a, b); }
+		static V Greater(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		// mask ? a : b
+		static V Select(V mask, V a, V b) { return _mm256_blendv_ps(b, a, mask); }
+	};
+
+	/**
+	 * @brief	sin / cos 𓯎ɌvZiXMScalarSinCos Ɠ11 / 10̃~j}bNXߎj
+	 */
+	template<typename L>
+	void SinCos(typename L::V x, typename L::V& outSin, typename L::V& outCos)
+	{
+		using V = typename L::V;
+
+		// [-, ] ɐ܂Ԃ
+		V quotient = L::Round(L::Mul(x, L::Set(XM_1DIV2PI)));
+		V y = L::Sub(x, L::Mul(quotient, L::Set(XM_2PI)));
+
+		// [-/2, /2] ɐ܂Ԃisin ͕sρAcos ͕]j
+		V over = L::Greater(L::Abs(y), L::Set(XM_PIDIV2));
+		V reflected = L::Sub(L::Or(L::Set(XM_PI), L::SignBit(y)), y);
+		y = L::Select(over, reflected, y);
+		V sign = L::Select(over, L::Set(-1.0f), L::Set(1.0f));
+
+		V y2 = L::Mul(y, y);
+
+		V s = L::Set(-2.3889859e-08f);
+		s = L::Add(L::Mul(s, y2), L::Set(2.7525562e-06f));
+		s = L::Add(L::Mul(s, y2), L::Set(-0.00019840874f));
+		s = L::Add(L::Mul(s, y2), L::Set(0.0083333310f));
+		s = L::Add(L::Mul(s, y2), L::Set(-0.16666667f));
+		s = L::Add(L::Mul(s, y2), L::Set(1.0f));
+		outSin = L::Mul(s, y);
+
+		V c = L::Set(-2.6051615e-07f);
+		c = L::Add(L::Mul(c, y2), L::Set(2.4760495e-05f));
+		c = L::Add(L::Mul(c, y2), L::Set(-0.0013888378f));
+		c = L::Add(L::Mul(c, y2), L::Set(0.041666638f));
+		c = L::Add(L::Mul(c, y2), L::Set(-0.5f));
+		c = L::Add(L::Mul(c, y2), L::Set(1.0f));
+		outCos = L::Mul(c, sign);
+	}
+
+	/**
+	 * @brief	L::Width Transform܂Ƃ߂ČvZ
+	 */
+	template<typename L>
+	void ComposeBlock(Transform* const* transforms, const Transform* const* parents)
+	{
+		using V = typename L::V;
+		constexpr size_t W = L::Width;
+
+		// SoAƗ̈
+		alignas(32) float local[9][W];		// pos xyz, rot xyz, scale xyz
+		alignas(32) float parentM[16][W];
+		alignas(32) float parentQ[4][W];
+		alignas(32) float parentS[3][W];
+		alignas(32) float outM[16][W];
+		alignas(32) float outQ[4][W];
+		alignas(32) float outS[3][W];
+
+		// --- 1. W (AoS -> SoA) ---
+		for (size_t i = 0; i < W; ++i)
+		{
+			const Transform& t = *transforms[i];
+			local[0][i] = t.position.x; local[1][i] = t.position.y; local[2][i] = t.position.z;
+			local[3][i] = t.rotation.x; local[4][i] = t.rotation.y; local[5][i] = t.rotation.z;
+			local[6][i] = t.scale.x;    local[7][i] = t.scale.y;    local[8][i] = t.scale.z;
+
+			if (const Transform* p = parents[i])
+			{
+				XMFLOAT4X4 m;
+				XMStoreFloat4x4(&m, p->worldMatrix);
+				for (int k = 0; k < 16; ++k) parentM[k][i] = m.m[k / 4][k % 4];
+				parentQ[0][i] = p->worldRotation.x; parentQ[1][i] = p->worldRotation.y;
+				parentQ[2][i] = p->worldRotation.z; parentQ[3][i] = p->worldRotation.w;
+				parentS[0][i] = p->worldScale.x; parentS[1][i] = p->worldScale.y; parentS[2][i] = p->worldScale.z;
+			}
+			else
+			{
+				// [g͒Pʍs
+				for (int k = 0; k < 16; ++k) parentM[k][i] = (k % 5 == 0) ? 1.0f : 0.0f;
+				parentQ[0][i] = 0.0f; parentQ[1][i] = 0.0f; parentQ[2][i] = 0.0f; parentQ[3][i] = 1.0f;
+				parentS[0][i] = 1.0f; parentS[1][i] = 1.0f; parentS[2][i] = 1.0f;
+			}
+		}
+
+		// --- 2. [J]iXMQuaternionRotationRollPitchYaw Ɠj ---
+		V half = L::Set(0.5f);
+		V sp, cp, sy, cy, sr, cr;
+		SinCos<L>(L::Mul(L::Load(local[3]), half), sp, cp);	// pitch
+		SinCos<L>(L::Mul(L::Load(local[4]), half), sy, cy);	// yaw
+		SinCos<L>(L::Mul(L::Load(local[5]), half), sr, cr);	// roll
+
+		V qx = L::Add(L::Mul(L::Mul(sp, cy), cr), L::Mul(L::Mul(cp, sy), sr));
+		V qy = L::Sub(L::Mul(L::Mul(cp, sy), cr), L::Mul(L::Mul(sp, cy), sr));
+		V qz = L::Sub(L::Mul(L::Mul(cp, cy), sr), L::Mul(L::Mul(sp, sy), cr));
+		V qw = L::Add(L::Mul(L::Mul(cp, cy), cr), L::Mul(L::Mul(sp, sy), sr));
+
+		// --- 3. ]siXMMatrixRotationQuaternion ƓjɃXP[| ---
+		V one = L::Set(1.0f);
+		V two = L::Set(2.0f);
+		V xx = L::Mul(qx, qx), yy = L::Mul(qy, qy), zz = L::Mul(qz, qz);
+		V xy = L::Mul(qx, qy), xz = L::Mul(qx, qz), yz = L::Mul(qy, qz);
+		V xw = L::Mul(qx, qw), yw = L::Mul(qy, qw), zw = L::Mul(qz, qw);
+
+		V sx = L::Load(local[6]), sY = L::Load(local[7]), sz = L::Load(local[8]);
+		V l[3][3];
+		l[0][0] = L::Mul(L::Sub(one, L::Mul(two, L::Add(yy, zz))), sx);
+		l[0][1] = L::Mul(L::Mul(two, L::Add(xy, zw)), sx);
+		l[0][2] = L::Mul(L::Mul(two, L::Sub(xz, yw)), sx);
+		l[1][0] = L::Mul(L::Mul(two, L::Sub(xy, zw)), sY);
+		l[1][1] = L::Mul(L::Sub(one, L::Mul(two, L::Add(xx, zz))), sY);
+		l[1][2] = L::Mul(L::Mul(two, L::Add(yz, xw)), sY);
+		l[2][0] = L::Mul(L::Mul(two, L::Add(xz, yw)), sz);
+		l[2][1] = L::Mul(L::Mul(two, L::Sub(yz, xw)), sz);
+		l[2][2] = L::Mul(L::Sub(one, L::Mul(two, L::Add(xx, yy))), sz);
+
+		// --- 4. [hs = [J * e ---
+		V p[16];
+		for (int k = 0; k < 16; ++k) p[k] = L::Load(parentM[k]);
+
+		for (int r = 0; r < 3; ++r)
+		{
+			for (int c = 0; c < 4; ++c)
+			{
+				V v = L::Mul(l[r][0], p[c]);
+				v = L::Add(v, L::Mul(l[r][1], p[4 + c]));
+				v = L::Add(v, L::Mul(l[r][2], p[8 + c]));
+				L::Store(outM[r * 4 + c], v);
+			}
+		}
+		V px = L::Load(local[0]), py = L::Load(local[1]), pz = L::Load(local[2]);
+		for (int c = 0; c < 4; ++c)
+		{
+			V v = L::Mul(px, p[c]);
+			v = L::Add(v, L::Mul(py, p[4 + c]));
+			v = L::Add(v, L::Mul(pz, p[8 + c]));
+			v = L::Add(v, p[12 + c]);
+			L::Store(outM[12 + c], v);
+		}
+
+		// --- 5. [h] = XMQuaternionMultiply(local, parent) ---
+		V ax = L::Load(parentQ[0]), ay = L::Load(parentQ[1]), az = L::Load(parentQ[2]), aw = L::Load(parentQ[3]);
+		L::Store(outQ[0], L::Sub(L::Add(L::Add(L::Mul(aw, qx), L::Mul(ax, qw)), L::Mul(ay, qz)), L::Mul(az, qy)));
+		L::Store(outQ[1], L::Add(L::Add(L::Sub(L::Mul(aw, qy), L::Mul(ax, qz)), L::Mul(ay, qw)), L::Mul(az, qx)));
+		L::Store(outQ[2], L::Add(L::Sub(L::Add(L::Mul(aw, qz), L::Mul(ax, qy)), L::Mul(ay, qx)), L::Mul(az, qw)));
+		L::Store(outQ[3], L::Sub(L::Sub(L::Sub(L::Mul(aw, qw), L::Mul(ax, qx)), L::Mul(ay, qy)), L::Mul(az, qz)));
+
+		// --- 6. [hXP[ ---
+		L::Store(outS[0], L::Mul(sx, L::Load(parentS[0])));
+		L::Store(outS[1], L::Mul(sY, L::Load(parentS[1])));
+		L::Store(outS[2], L::Mul(sz, L::Load(parentS[2])));
+
+		// --- 7. ߂ (SoA -> AoS) ---
+		for (size_t i = 0; i < W; ++i)
+		{
+			Transform& t = *transforms[i];
+			XMFLOAT4X4 m;
+			for (int k = 0; k < 16; ++k) m.m[k / 4][k % 4] = outM[k][i];
+			t.worldMatrix = XMLoadFloat4x4(&m);
+			t.worldPosition = { m._41, m._42, m._43 };
+			t.worldRotation = { outQ[0][i], outQ[1][i], outQ[2][i], outQ[3][i] };
+			t.worldScale = { outS[0][i], outS[1][i], outS[2][i] };
+		}
+	}
+#endif // TRANSFORM_BATCH_SIMD
+
+	// CPUID őΉ߂𔻒
+	TransformBatch::Path DetectPath()
+	{
+#if TRANSFORM_BATCH_SIMD
+		int info[4] = {};
+		__cpuid(info, 0);
+		int maxId = info[0];
+
+		__cpuid(info, 1);
+		bool sse2 = (info[3] & (1 << 26)) != 0;
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+
+		// AVXOSYMMWX^ۑĂꍇ̂ݎg
+		bool avx2 = false;
+		if (maxId >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+		{
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+
+		if (avx2) return TransformBatch::Path::AVX2;
+		if (sse2) return TransformBatch::Path::SSE;
+#endif
+		return TransformBatch::Path::Scalar;
+	}
+}
+
+namespace TransformBatch
+{
+	Path GetBestPath()
+	{
+		static const Path path = DetectPath();
+		return path;
+	}
+
+	const char* GetPathName(Path path)
+	{
+		switch (path)
+		{
+		case Path::SSE:		return "SSE";
+		case Path::AVX2:	return "AVX2";
+		default:			return "Scalar";
+		}
+	}
+
+	void ComposeWorld(Transform* const* transforms, const Transform* const* parents, size_t count, Path path)
+	{
+		size_t i = 0;
+
+#if TRANSFORM_BATCH_SIMD
+		// 8 -> c4 -> [̓XJ[
+		if (path == Path::AVX2)
+		{
+			for (; i + LaneAVX2::Width <= count; i += LaneAVX2::Width)
+			{
+				ComposeBlock<LaneAVX2>(transforms + i, parents + i);
+			}
+		}
+		if (path != Path::Scalar)
+		{
+			for (; i + LaneSSE::Width <= count; i += LaneSSE::Width)
+			{
+				ComposeBlock<LaneSSE>(transforms + i, parents + i);
+			}
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			ComposeScalar(*transforms[i], parents[i]);
+		}
+	}
+
+	BenchmarkResult RunBenchmark(size_t count, int iterations)
+	{
+		BenchmarkResult result;
+		result.count = count;
+		result.simdPath = GetBestPath();
+		if (count == 0 || iterations <= 0) return result;
+
+		// O[gA㔼̎qƂ2Kw
+		std::mt19937 rng(12345);
+		std::uniform_real_distribution<float> posDist(-50.0f, 50.0f);
+		std::uniform_real_distribution<float> rotDist(-XM_2PI, XM_2PI);
+		std::uniform_real_distribution<float> sclDist(0.5f, 2.0f);
+
+		std::vector<Transform> source(count);
+		for (auto& t : source)
+		{
+			t.position = { posDist(rng), posDist(rng), posDist(rng) };
+			t.rotation = { rotDist(rng), rotDist(rng), rotDist(rng) };
+			t.scale = { sclDist(rng), sclDist(rng), sclDist(rng) };
+		}
+		size_t rootCount = (count + 1) / 2;
+
+		auto measure = [&](Path path, std::vector<Transform>& ts) -> double
+			{
+				ts = source;
+				std::vector<Transform*> roots, children;
+				std::vector<const Transform*> rootParents(rootCount, nullptr), childParents;
+				for (size_t i = 0; i < count; ++i)
+				{
+					if (i < rootCount) roots.push_back(&ts[i]);
+					else
+					{
+						children.push_back(&ts[i]);
+						childParents.push_back(&ts[i - rootCount]);
+					}
+				}
+
+				auto start = std::chrono::high_resolution_clock::now();
+				for (int it = 0; it < iterations; ++it)
+				{
+					ComposeWorld(roots.data(), rootParents.data(), roots.size(), path);
+					ComposeWorld(children.data(), childParents.data(), children.size(), path);
+				}
+				auto end = std::chrono::high_resolution_clock::now();
+				std::chrono::duration<double, std::milli> ms = end - start;
+				return ms.count() / iterations;
+			};
+
+		std::vector<Transform> scalarResult, simdResult;
+		result.scalarMs = measure(Path::Scalar, scalarResult);
+		result.simdMs = measure(result.simdPath, simdResult);
+
+		// svfƂ̌덷
+		for (size_t i = 0; i < count; ++i)
+		{
+			XMFLOAT4X4 a, b;
+			XMStoreFloat4x4(&a, scalarResult[i].worldMatrix);
+			XMStoreFloat4x4(&b, simdResult[i].worldMatrix);
+			for (int k = 0; k < 16; ++k)
+			{
+				result.maxError = std::max(result.maxError, std::abs(a.m[k / 4][k % 4] - b.m[k / 4][k % 4]));
+			}
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,79 @@
+/*****************************************************************//**
+ * @file	TransformBatch.h
+ * @brief	Transform̃[hs܂Ƃ߂ČvZob`J[l
+ *
+ * @details
+ * S * R * T ̍Ɛes̏ZASSEi4j/ AVX2i8jœɍs܂B
+ * IC[p sin / cos xNgĂ܂B
+ * CPUAVX2 / SSE2ɑΉĂȂꍇ͎sɃXJ[ł֐؂ւ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___TRANSFORM_BATCH_H___
+#define ___TRANSFORM_BATCH_H___
+
+// ===== CN[h =====
+#include "Engine/ECS/ECS.h"
+#include "Game/Components/Components.h"
+#include <cstddef>
+
+namespace TransformBatch
+{
+	/**
+	 * @enum	Path
+	 * @brief	vZoH
+	 */
+	enum class Path
+	{
+		Scalar,	// DirectXMathɂ1̌vZ
+		SSE,	// 4
+		AVX2,	// 8
+	};
+
+	// CPUΉĂő̌oHiĂяoɔj
+	Path GetBestPath();
+
+	// oHifobO\pj
+	const char* GetPathName(Path path);
+
+	/**
+	 * @brief	[JlƐẽ[hlA[hsƕς݂̒l
+	 * @param	transforms	vZΏہicountj
+	 * @param	parents		eΏۂ̐ei[g nullptrjBe͌vZς݂ł邱
+	 */
+	void ComposeWorld(Transform* const* transforms, const Transform* const* parents, size_t count, Path path);
+
+	inline void ComposeWorld(Transform* const* transforms, const Transform* const* parents, size_t count)
+	{
+		ComposeWorld(transforms, parents, count, GetBestPath());
+	}
+
+	/**
+	 * @struct	BenchmarkResult
+	 * @brief	XJ[łSIMDł̔r
+	 */
+	struct BenchmarkResult
+	{
+		size_t count = 0;		// 1񂠂Transform
+		Path simdPath = Path::Scalar;
+		double scalarMs = 0.0;	// 1񂠂̕ώ
+		double simdMs = 0.0;
+		float maxError = 0.0f;	// [hsvf̍ő덷
+	};
+
+	// _ȐeqtTransform count AoH iterations 񂸂v
+	BenchmarkResult RunBenchmark(size_t count, int iterations);
+}
+
+#endif // !___TRANSFORM_BATCH_H___
@@ -0,0 +1,160 @@
+/*****************************************************************//**
+ * @file	Broadphase.cpp
+ * @brief	u[htF[Y̋ʏi쐬Evj
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/Broadphase.h"
+#include "Game/Systems/Physics/SweepAndPrune.h"
+#include "Game/Systems/Physics/TreeBroadphase.h"
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include <random>
+#include <algorithm>
+#include <chrono>
+
+namespace Physics
+{
+	void GridBroadphase::Update(const std::vector<CollisionProxy>& proxies, std::vector<BroadphasePair>& outPairs)
+	{
+		++m_frame;
+
+		// --- 1. o^̍XViZςtւj ---
+		for (uint32_t i = 0; i < (uint32_t)proxies.size(); ++i)
+		{
+			const auto& p = proxies[i];
+			if (m_entityToProxy.size() <= p.entity)
+			{
+				m_entityToProxy.resize(p.entity + 1, 0);
+				m_seenFrame.resize(p.entity + 1, 0);
+			}
+			if (m_seenFrame[p.entity] == 0) m_entities.push_back(p.entity);
+
+			m_grid.Move(p.entity, p.aabbMin, p.aabbMax);
+			m_entityToProxy[p.entity] = i;
+			m_seenFrame[p.entity] = m_frame;
+		}
+
+		// --- 2. t[Ȃ̂폜 ---
+		for (size_t k = 0; k < m_entities.size();)
+		{
+			Entity e = m_entities[k];
+			if (m_seenFrame[e] != m_frame)
+			{
+				m_grid.Remove(e);
+				m_seenFrame[e] = 0;
+				m_entities[k] = m_entities.back();
+				m_entities.pop_back();
+			}
+			else
+			{
+				++k;
+			}
+		}
+
+		// --- 3. Entity ̑g proxies ̓Yɕϊ ---
+		m_grid.BuildPairs(m_gridPairs);
+		outPairs.clear();
+		outPairs.reserve(m_gridPairs.size());
+		for (const auto& pair : m_gridPairs)
+		{
+			uint32_t a = m_entityToProxy[pair.first];
+			uint32_t b = m_entityToProxy[pair.second];
+			outPairs.push_back(a < b ? BroadphasePair(a, b) : BroadphasePair(b, a));
+		}
+		std::sort(outPairs.begin(), outPairs.end());
+	}
+
+	std::unique_ptr<IBroadphase> CreateBroadphase(BroadphaseType type)
+	{
+		switch (type)
+		{
+		case BroadphaseType::SweepAndPrune:	return std::make_unique<SweepAndPrune>();
+		case BroadphaseType::DynamicTree:	return std::make_unique<TreeBroadphase>();
+		default:							return std::make_unique<GridBroadphase>();
+		}
+	}
+
+	const char* GetBroadphaseName(BroadphaseType type)
+	{
+		switch (type)
+		{
+		case BroadphaseType::SweepAndPrune:	return "sap";
+		case BroadphaseType::DynamicTree:	return "tree";
+		default:							return "grid";
+		}
+	}
+
+	BroadphaseBenchmarkResult RunBroadphaseBenchmark(BroadphaseType type, size_t count, int frames)
+	{
+		BroadphaseBenchmarkResult result;
+		if (count == 0 || frames <= 0) return result;
+
+		// 1 2m ̔Aς1 4m lɎ܂悤ׂ
+		std::mt19937 rng(12345);
+		float range = std::cbrt((float)count) * 4.0f;
+		std::uniform_real_distribution<float> posDist(-range * 0.5f, range * 0.5f);
+		std::uniform_real_distribution<float> velDist(-0.02f, 0.02f);	// 1t[̈ړʁij
+
+		std::vector<CollisionProxy> proxies(count);
+		std::vector<XMFLOAT3> velocity(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			auto& p = proxies[i];
+			p.entity = (Entity)(i + 1);
+			p.type = ColliderType::Box;
+			p.isTrigger = false;
+			p.bodyType = BodyType::Dynamic;
+			p.isSleeping = false;
+			p.layer = CollisionLayer::Default;
+			p.mask = 0xFFFFFFFFu;
+			XMFLOAT3 c = { posDist(rng), posDist(rng), posDist(rng) };
+			p.aabbMin = { c.x - 1.0f, c.y - 1.0f, c.z - 1.0f };
+			p.aabbMax = { c.x + 1.0f, c.y + 1.0f, c.z + 1.0f };
+			velocity[i] = { velDist(rng), velDist(rng), velDist(rng) };
+		}
+
+		auto broadphase = CreateBroadphase(type);
+		std::vector<BroadphasePair> pairs;
+		double totalMs = 0.0;
+		size_t totalPairs = 0;
+
+		for (int f = 0; f < frames; ++f)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				auto& p = proxies[i];
+				const auto& v = velocity[i];
+				p.aabbMin = { p.aabbMin.x + v.x, p.aabbMin.y + v.y, p.aabbMin.z + v.z };
+				p.aabbMax = { p.aabbMax.x + v.x, p.aabbMax.y + v.y, p.aabbMax.z + v.z };
+			}
+
+			auto start = std::chrono::high_resolution_clock::now();
+			broadphase->Update(proxies, pairs);
+			auto end = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double, std::milli> ms = end - start;
+
+			totalMs += ms.count();
+			totalPairs += pairs.size();
+		}
+
+		result.averageMs = totalMs / frames;
+		result.averagePairs = totalPairs / frames;
+		return result;
+	}
+}
@@ -0,0 +1,109 @@
+/*****************************************************************//**
+ * @file	Broadphase.h
+ * @brief	u[htF[YiՓˌyA̍i荞݁j̋ʃC^[tF[X
+ *
+ * @details
+ * CollisionSystem ͂Œ` IBroadphase ʂČyA󂯎܂B
+ * iԃObh / Sweep and Prune / IAABBc[j͎sɐ؂ւ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___BROADPHASE_H___
+#define ___BROADPHASE_H___
+
+// ===== CN[h =====
+#include "Engine/ECS/ECS.h"
+#include "Game/Systems/Physics/SpatialGrid.h"
+#include <vector>
+#include <memory>
+#include <utility>
+
+namespace Physics
+{
+	struct CollisionProxy;
+
+	// proxies ̓Y̑gifirst < secondj
+	using BroadphasePair = std::pair<uint32_t, uint32_t>;
+
+	/**
+	 * @enum	BroadphaseType
+	 * @brief	u[htF[Y̎
+	 */
+	enum class BroadphaseType
+	{
+		Grid,			// Kw^̋ԃObhiZςtւj
+		SweepAndPrune,	// 3̒[_\[giOt[̌ʂXVj
+		DynamicTree,	// IAABBc[ifat AABB ͂ݏođ}j
+	};
+
+	/**
+	 * @class	IBroadphase
+	 * @brief	u[htF[Y̊NX
+	 */
+	class IBroadphase
+	{
+	public:
+		virtual ~IBroadphase() = default;
+
+		/**
+		 * @brief	vLVAABBAdȂĂyA߂
+		 * @param	outPairs	proxies ̓Y̑gifirst < secondAAdȂj
+		 */
+		virtual void Update(const std::vector<CollisionProxy>& proxies, std::vector<BroadphasePair>& outPairs) = 0;
+
+		virtual BroadphaseType GetType() const = 0;
+	};
+
+	/**
+	 * @class	GridBroadphase
+	 * @brief	SpatialGrid gu[htF[Y
+	 * @details	Entity ̂܂܃Obh̔ԍɂāAOt[̓o^ Move ōXV܂B
+	 */
+	class GridBroadphase
+		: public IBroadphase
+	{
+	public:
+		void Update(const std::vector<CollisionProxy>& proxies, std::vector<BroadphasePair>& outPairs) override;
+		BroadphaseType GetType() const override { return BroadphaseType::Grid; }
+
+	private:
+		SpatialGrid m_grid;
+		std::vector<uint32_t> m_entityToProxy;	// Entity -> t[ proxies ̓Y
+		std::vector<uint32_t> m_seenFrame;		// Entity -> ŌɍXVꂽt[
+		std::vector<Entity> m_entities;			// Obhɓo^Ă Entity
+		std::vector<SpatialGrid::Pair> m_gridPairs;
+		uint32_t m_frame = 0;
+	};
+
+	// ނɉu[htF[Y쐬
+	std::unique_ptr<IBroadphase> CreateBroadphase(BroadphaseType type);
+
+	// Oi"grid" / "sap" / "tree"j
+	const char* GetBroadphaseName(BroadphaseType type);
+
+	/**
+	 * @struct	BroadphaseBenchmarkResult
+	 * @brief	u[htF[YP̂̌v
+	 */
+	struct BroadphaseBenchmarkResult
+	{
+		double averageMs = 0.0;		// 1t[̕ώ
+		size_t averagePairs = 0;	// 1t[̕σyA
+	};
+
+	// 蓮 count ׁAframes t[̍XVԂv
+	BroadphaseBenchmarkResult RunBroadphaseBenchmark(BroadphaseType type, size_t count, int frames);
+}
+
+#endif // !___BROADPHASE_H___
@@ -19,12 +19,18 @@
 
 // ===== CN[h =====
 #define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
 #include "Game/Systems/Physics/CollisionSystem.h"
+#include "Game/Systems/Physics/NarrowPhaseBatch.h"
+#include "Engine/Core/JobSystem.h"
 #include <cmath>
 #include <iostream>
 #include <algorithm>
 #include <vector>
 #include <set>
+#include <cstring>
+#include <iterator>
+#include <chrono>
 
 using namespace Physics;
 
@@ -238,6 +244,317 @@ bool IntersectRayCapsule(XMVECTOR origin, XMVECTOR dir, const Physics::Capsule&
 	return false;
 }
 
+// C vs ~iʂƏ㉺̖ʁj
+bool IntersectRayCylinder(XMVECTOR origin, XMVECTOR dir, const Physics::Cylinder& cyl, float& t)
+{
+	XMVECTOR axis = XMLoadFloat3(&cyl.axis);
+	XMVECTOR m = origin - XMLoadFloat3(&cyl.center);
+	float halfHeight = cyl.height * 0.5f;
+
+	// ̐ƁAɐȐɕ
+	float md = XMVectorGetX(XMVector3Dot(m, axis));
+	float dd = XMVectorGetX(XMVector3Dot(dir, axis));
+	XMVECTOR mp = m - axis * md;
+	XMVECTOR dp = dir - axis * dd;
+
+	float tMin = 0.0f;
+	float tMax = FLT_MAX;
+
+	// ʁiɒ~̓ɂԁj
+	float a = XMVectorGetX(XMVector3Dot(dp, dp));
+	float b = XMVectorGetX(XMVector3Dot(mp, dp));
+	float c = XMVectorGetX(XMVector3Dot(mp, mp)) - cyl.radius * cyl.radius;
+	if (a > 1e-8f)
+	{
+		float discr = b * b - a * c;
+		if (discr < 0.0f) return false;
+		float s = sqrt(discr);
+		tMin = std::max(tMin, (-b - s) / a);
+		tMax = std::min(tMax, (-b + s) / a);
+	}
+	else if (c > 0.0f) return false;	// ƕsŁA~̊O
+
+	// ㉺̖ʂ̊Ԃɂ
+	if (std::abs(dd) > 1e-8f)
+	{
+		float t1 = (-halfHeight - md) / dd;
+		float t2 = (halfHeight - md) / dd;
+		if (t1 > t2) std::swap(t1, t2);
+		tMin = std::max(tMin, t1);
+		tMax = std::min(tMax, t2);
+	}
+	else if (std::abs(md) > halfHeight) return false;
+
+	if (tMin > tMax) return false;
+	t = tMin;
+	return true;
+}
+
+
+// bV̎Op`ifǂ߂ĂȂ nullptrj
+const TriangleMesh* MeshOf(const MeshInstance& m)
+{
+	return TriangleMeshLibrary::Instance().Find(m.mesh);
+}
+
+// bṼfԂ̎i[hԂł̌j
+void MeshAxes(const MeshInstance& m, XMFLOAT3 axes[3])
+{
+	XMFLOAT4X4 rotM; XMStoreFloat4x4(&rotM, XMMatrixRotationQuaternion(XMLoadFloat4(&m.rotation)));
+	axes[0] = { rotM._11, rotM._12, rotM._13 };
+	axes[1] = { rotM._21, rotM._22, rotM._23 };
+	axes[2] = { rotM._31, rotM._32, rotM._33 };
+}
+
+// bṼXP[i0 ŊȂ悤AlŎ~߂j
+XMVECTOR MeshScale(const MeshInstance& m)
+{
+	auto safe = [](float v) { return std::abs(v) < 1e-6f ? 1e-6f : v; };
+	return XMVectorSet(safe(m.scale.x), safe(m.scale.y), safe(m.scale.z), 1.0f);
+}
+
+// fԂ̓_ -> [h
+XMVECTOR MeshToWorld(const MeshInstance& m, FXMVECTOR local)
+{
+	return XMVector3Rotate(local * XMLoadFloat3(&m.scale), XMLoadFloat4(&m.rotation)) + XMLoadFloat3(&m.position);
+}
+
+// V ̍siOp`܂Ƃ߂Ĉڂpj
+XMMATRIX MeshMatrix(const MeshInstance& m)
+{
+	return XMMatrixScaling(m.scale.x, m.scale.y, m.scale.z) * XMMatrixRotationQuaternion(XMLoadFloat4(&m.rotation)) *
+		XMMatrixTranslation(m.position.x, m.position.y, m.position.z);
+}
+
+// [hԂ̓_E -> fԁi͐KȂ̂ŁAC̋̓[hƓɂȂj
+XMVECTOR MeshPointToLocal(const MeshInstance& m, FXMVECTOR world)
+{
+	return XMVector3InverseRotate(world - XMLoadFloat3(&m.position), XMLoadFloat4(&m.rotation)) / MeshScale(m);
+}
+
+XMVECTOR MeshDirToLocal(const MeshInstance& m, FXMVECTOR dir)
+{
+	return XMVector3InverseRotate(dir, XMLoadFloat4(&m.rotation)) / MeshScale(m);
+}
+
+// [hԂAABB͂ށAfԂAABB
+Physics::AABB MeshLocalBounds(const MeshInstance& m, const XMFLOAT3& worldMin, const XMFLOAT3& worldMax)
+{
+	XMVECTOR wMin = XMLoadFloat3(&worldMin), wMax = XMLoadFloat3(&worldMax);
+	XMVECTOR center = MeshPointToLocal(m, (wMin + wMax) * 0.5f);
+	XMFLOAT3 e; XMStoreFloat3(&e, (wMax - wMin) * 0.5f);
+	XMFLOAT3 s; XMStoreFloat3(&s, XMVectorAbs(MeshScale(m)));
+
+	XMFLOAT3 axes[3];
+	MeshAxes(m, axes);
+	const float sc[3] = { s.x, s.y, s.z };
+	float le[3];
+	for (int j = 0; j < 3; ++j) {
+		le[j] = (std::abs(axes[j].x) * e.x + std::abs(axes[j].y) * e.y + std::abs(axes[j].z) * e.z) / sc[j];
+	}
+	XMVECTOR ext = XMVectorSet(le[0], le[1], le[2], 0.0f);
+	Physics::AABB box;
+	XMStoreFloat3(&box.min, center - ext);
+	XMStoreFloat3(&box.max, center + ext);
+	return box;
+}
+
+// vLṼ[hAABBvZiu[htF[Ypj
+void ComputeAABB(CollisionProxy& p)
+{
+	XMFLOAT3 c = {}, e = {};
+	switch (p.type)
+	{
+	case ColliderType::Box:
+		c = p.obb.center;
+		// e̓e̍v
+		e.x = std::abs(p.obb.axes[0].x) * p.obb.extents.x + std::abs(p.obb.axes[1].x) * p.obb.extents.y + std::abs(p.obb.axes[2].x) * p.obb.extents.z;
+		e.y = std::abs(p.obb.axes[0].y) * p.obb.extents.x + std::abs(p.obb.axes[1].y) * p.obb.extents.y + std::abs(p.obb.axes[2].y) * p.obb.extents.z;
+		e.z = std::abs(p.obb.axes[0].z) * p.obb.extents.x + std::abs(p.obb.axes[1].z) * p.obb.extents.y + std::abs(p.obb.axes[2].z) * p.obb.extents.z;
+		break;
+	case ColliderType::Sphere:
+		c = p.sphere.center;
+		e = { p.sphere.radius, p.sphere.radius, p.sphere.radius };
+		break;
+	case ColliderType::Capsule:
+	{
+		const auto& s = p.capsule.start;
+		const auto& t = p.capsule.end;
+		float r = p.capsule.radius;
+		c = { (s.x + t.x) * 0.5f, (s.y + t.y) * 0.5f, (s.z + t.z) * 0.5f };
+		e = { std::abs(t.x - s.x) * 0.5f + r, std::abs(t.y - s.y) * 0.5f + r, std::abs(t.z - s.z) * 0.5f + r };
+		break;
+	}
+	case ColliderType::Cylinder:
+	{
+		const auto& a = p.cylinder.axis;
+		float hH = p.cylinder.height * 0.5f;
+		float r = p.cylinder.radius;
+		c = p.cylinder.center;
+		// ̔̒ + ɐȉ~Ղ̍L
+		e.x = std::abs(a.x) * hH + r * std::sqrt(std::max(0.0f, 1.0f - a.x * a.x));
+		e.y = std::abs(a.y) * hH + r * std::sqrt(std::max(0.0f, 1.0f - a.y * a.y));
+		e.z = std::abs(a.z) * hH + r * std::sqrt(std::max(0.0f, 1.0f - a.z * a.z));
+		break;
+	}
+	case ColliderType::Mesh:
+	{
+		// fԂAABBiBVH ̍j𔠂Ɠeɓe
+		const MeshInstance& m = p.mesh;
+		c = m.position;
+		const TriangleMesh* mesh = MeshOf(m);
+		if (!mesh) break;
+		const Physics::AABB& local = mesh->GetBounds();
+		XMFLOAT3 lc = { (local.min.x + local.max.x) * 0.5f, (local.min.y + local.max.y) * 0.5f, (local.min.z + local.max.z) * 0.5f };
+		XMStoreFloat3(&c, MeshToWorld(m, XMLoadFloat3(&lc)));
+
+		XMFLOAT3 axes[3];
+		MeshAxes(m, axes);
+		const float le[3] = {
+			(local.max.x - local.min.x) * 0.5f * std::abs(m.scale.x),
+			(local.max.y - local.min.y) * 0.5f * std::abs(m.scale.y),
+			(local.max.z - local.min.z) * 0.5f * std::abs(m.scale.z),
+		};
+		e.x = std::abs(axes[0].x) * le[0] + std::abs(axes[1].x) * le[1] + std::abs(axes[2].x) * le[2];
+		e.y = std::abs(axes[0].y) * le[0] + std::abs(axes[1].y) * le[1] + std::abs(axes[2].y) * le[2];
+		e.z = std::abs(axes[0].z) * le[0] + std::abs(axes[1].z) * le[1] + std::abs(axes[2].z) * le[2];
+		break;
+	}
+	}
+	p.aabbMin = { c.x - e.x, c.y - e.y, c.z - e.z };
+	p.aabbMax = { c.x + e.x, c.y + e.y, c.z + e.z };
+}
+
+// Transform  Collider 烏[hԂ̃vLV
+void BuildProxy(Entity entity, const Transform& t, const Collider& c, BodyType bodyType, CollisionProxy& p)
+{
+	p.entity = entity;
+	p.type = c.type;
+	p.isTrigger = c.isTrigger;
+	p.bodyType = bodyType;
+	p.isSleeping = false;
+	p.layer = c.layer;
+	p.mask = c.mask;
+
+	const XMFLOAT3& gScale = t.worldScale;
+	XMMATRIX rotMat = XMMatrixRotationQuaternion(XMLoadFloat4(&t.worldRotation));
+
+	XMVECTOR offsetVec = XMLoadFloat3(&c.offset);
+	XMVECTOR centerVec = XMVector3Transform(offsetVec, t.worldMatrix);
+	XMFLOAT3 center; XMStoreFloat3(&center, centerVec);
+
+	if (c.type == ColliderType::Box) {
+		p.obb.center = center;
+		p.obb.extents = { c.boxSize.x * gScale.x * 0.5f, c.boxSize.y * gScale.y * 0.5f, c.boxSize.z * gScale.z * 0.5f };
+		XMFLOAT4X4 rotM; XMStoreFloat4x4(&rotM, rotMat);
+		p.obb.axes[0] = { rotM._11, rotM._12, rotM._13 };
+		p.obb.axes[1] = { rotM._21, rotM._22, rotM._23 };
+		p.obb.axes[2] = { rotM._31, rotM._32, rotM._33 };
+	}
+	else if (c.type == ColliderType::Sphere) {
+		p.sphere.center = center;
+		p.sphere.radius = c.sphere.radius * std::max({ gScale.x, gScale.y, gScale.z });
+	}
+	else if (c.type == ColliderType::Capsule) {
+		XMVECTOR axisY = XMVector3TransformNormal(XMVectorSet(0, 1, 0, 0), rotMat);
+		float h = c.capsule.height * gScale.y;
+		float r = c.capsule.radius * std::max(gScale.x, gScale.z);
+		float segLen = std::max(0.0f, h * 0.5f - r);
+		XMStoreFloat3(&p.capsule.start, centerVec - axisY * segLen);
+		XMStoreFloat3(&p.capsule.end, centerVec + axisY * segLen);
+		p.capsule.radius = r;
+	}
+	else if (c.type == ColliderType::Cylinder) {
+		XMStoreFloat3(&p.cylinder.center, centerVec);
+		XMVECTOR axisY = XMVector3TransformNormal(XMVectorSet(0, 1, 0, 0), rotMat);
+		XMStoreFloat3(&p.cylinder.axis, axisY);
+		p.cylinder.height = c.cylinder.height * gScale.y;
+		p.cylinder.radius = c.cylinder.radius * std::max(gScale.x, gScale.z);
+	}
+	else if (c.type == ColliderType::Mesh) {
+		// Op`̓fƂ1Ał͒u
+		p.mesh.mesh = Physics::TriangleMeshLibrary::Instance().GetId(c.meshKey);
+		p.mesh.position = center;
+		p.mesh.rotation = t.worldRotation;
+		p.mesh.scale = gScale;
+	}
+	ComputeAABB(p);
+}
+
+// `󂩁iÓILbV̍蒼pBp͎̂gĂ镪ׂj
+bool SameCollider(const Collider& a, const Collider& b)
+{
+	if (a.type != b.type || a.isTrigger != b.isTrigger) return false;
+	if (a.layer != b.layer || a.mask != b.mask) return false;
+	if (a.offset.x != b.offset.x || a.offset.y != b.offset.y || a.offset.z != b.offset.z) return false;
+
+	switch (a.type)
+	{
+	case ColliderType::Box:			return a.boxSize.x == b.boxSize.x && a.boxSize.y == b.boxSize.y && a.boxSize.z == b.boxSize.z;
+	case ColliderType::Sphere:		return a.sphere.radius == b.sphere.radius;
+	case ColliderType::Capsule:		return a.capsule.radius == b.capsule.radius && a.capsule.height == b.capsule.height;
+	case ColliderType::Cylinder:	return a.cylinder.radius == b.cylinder.radius && a.cylinder.height == b.cylinder.height;
+	case ColliderType::Mesh:		return a.meshKey == b.meshKey;
+	}
+	return true;
+}
+
+// vLV𕽍sړiAœr̈ʒuj
+void TranslateProxy(CollisionProxy& p, FXMVECTOR offset)
+{
+	auto move = [&](XMFLOAT3& v) { XMStoreFloat3(&v, XMLoadFloat3(&v) + offset); };
+	switch (p.type)
+	{
+	case ColliderType::Box:			move(p.obb.center); break;
+	case ColliderType::Sphere:		move(p.sphere.center); break;
+	case ColliderType::Capsule:		move(p.capsule.start); move(p.capsule.end); break;
+	case ColliderType::Cylinder:	move(p.cylinder.center); break;
+	case ColliderType::Mesh:		move(p.mesh.position); break;
+	}
+	move(p.aabbMin);
+	move(p.aabbMax);
+}
+
+// `̈ԍׂ̔i1ɂȉi߂Ȃ΁AǂщzȂj
+float MinHalfSize(const CollisionProxy& p)
+{
+	switch (p.type)
+	{
+	case ColliderType::Box:			return std::min({ p.obb.extents.x, p.obb.extents.y, p.obb.extents.z });
+	case ColliderType::Sphere:		return p.sphere.radius;
+	case ColliderType::Capsule:		return p.capsule.radius;
+	case ColliderType::Cylinder:	return std::min(p.cylinder.radius, p.cylinder.height * 0.5f);
+	case ColliderType::Mesh:		return FLT_MAX;	// ݂̂ŁAi߂ʂ͑̑傫Ō߂
+	}
+	return 0.0f;
+}
+
+// _ start  disp iފԂɁAmargin c܂ OBB ɓ銄iXu@j
+bool SegmentEnterOBB(FXMVECTOR start, FXMVECTOR disp, const OBB& box, float margin, float& outT)
+{
+	XMVECTOR d = start - XMLoadFloat3(&box.center);
+	const float extents[3] = { box.extents.x + margin, box.extents.y + margin, box.extents.z + margin };
+	float tMin = 0.0f, tMax = 1.0f;
+
+	for (int i = 0; i < 3; ++i) {
+		XMVECTOR axis = XMLoadFloat3(&box.axes[i]);
+		float p = XMVectorGetX(XMVector3Dot(d, axis));
+		float v = XMVectorGetX(XMVector3Dot(disp, axis));
+
+		if (std::abs(v) < 1e-8f) {
+			if (std::abs(p) > extents[i]) return false;
+			continue;
+		}
+		float t1 = (-extents[i] - p) / v;
+		float t2 = (extents[i] - p) / v;
+		if (t1 > t2) std::swap(t1, t2);
+		tMin = std::max(tMin, t1);
+		tMax = std::min(tMax, t2);
+		if (tMin > tMax) return false;
+	}
+	outT = tMin;
+	return true;
+}
 
 // =================================================================
 // Raycast ֐̏C
@@ -253,11 +570,9 @@ Entity CollisionSystem::Raycast(Registry& registry, const XMFLOAT3& rayOrigin, c
 
 	registry.view<Transform, Collider>([&](Entity e, Transform& t, Collider& c)
 		{
-			// [hs̕
-			XMVECTOR scale, rotQuat, pos;
-			XMMatrixDecompose(&scale, &rotQuat, &pos, t.worldMatrix);
-			XMFLOAT3 gScale; XMStoreFloat3(&gScale, scale);
-			XMMATRIX rotMat = XMMatrixRotationQuaternion(rotQuat);
+			// [hԂ̉]EXP[iHierarchySystemŃLbVς݁j
+			const XMFLOAT3& gScale = t.worldScale;
+			XMMATRIX rotMat = XMMatrixRotationQuaternion(XMLoadFloat4(&t.worldRotation));
 
 			// SW̌vZ
 			XMVECTOR offsetVec = XMLoadFloat3(&c.offset);
@@ -306,18 +621,23 @@ Entity CollisionSystem::Raycast(Registry& registry, const XMFLOAT3& rayOrigin, c
 			}
 			else if (c.type == ColliderType::Cylinder)
 			{
-				// ~̓JvZߎŔ
-				XMVECTOR axisY = XMVector3TransformNormal(XMVectorSet(0, 1, 0, 0), rotMat);
-				float h = c.cylinder.height * gScale.y;
-				float r = c.cylinder.radius * std::max(gScale.x, gScale.z);
-				float halfLen = h * 0.5f;
-
-				Physics::Capsule cap;
-				XMStoreFloat3(&cap.start, centerVec - axisY * halfLen);
-				XMStoreFloat3(&cap.end, centerVec + axisY * halfLen);
-				cap.radius = r;
+				Physics::Cylinder cyl;
+				cyl.center = center;
+				XMStoreFloat3(&cyl.axis, XMVector3Normalize(XMVector3TransformNormal(XMVectorSet(0, 1, 0, 0), rotMat)));
+				cyl.height = c.cylinder.height * gScale.y;
+				cyl.radius = c.cylinder.radius * std::max(gScale.x, gScale.z);
 
-				hit = IntersectRayCapsule(originV, dirV, cap, dist);
+				hit = IntersectRayCylinder(originV, dirV, cyl, dist);
+			}
+			else if (c.type == ColliderType::Mesh)
+			{
+				MeshInstance m = { Physics::TriangleMeshLibrary::Instance().GetId(c.meshKey), center, t.worldRotation, gScale };
+				if (const TriangleMesh* mesh = MeshOf(m)) {
+					XMFLOAT3 o, d;
+					XMStoreFloat3(&o, MeshPointToLocal(m, originV));
+					XMStoreFloat3(&d, MeshDirToLocal(m, dirV));
+					hit = mesh->RayCast(o, d, FLT_MAX, dist);
+				}
 			}
 
 			// ŋߐڂ̍XV
@@ -335,6 +655,282 @@ Entity CollisionSystem::Raycast(Registry& registry, const XMFLOAT3& rayOrigin, c
 	return closestEntity;
 }
 
+// =================================================================
+// ob`CLXg
+// =================================================================
+
+// vLVAABB margin L
+// Č_AABB̖ʂ̏ɂĖʂƕsȎi0 * INFINITY = NaNjɁA߂铖𗎂ƂȂ悤L
+Physics::AABB Inflate(const CollisionProxy& p, float margin)
+{
+	return {
+		{ p.aabbMin.x - margin, p.aabbMin.y - margin, p.aabbMin.z - margin },
+		{ p.aabbMax.x + margin, p.aabbMax.y + margin, p.aabbMax.z + margin }
+	};
+}
+
+// vLVƃČiRaycast Ɠj
+bool IntersectRayProxy(const CollisionProxy& p, XMVECTOR origin, XMVECTOR dir, float& t)
+{
+	bool hit = false;
+	switch (p.type)
+	{
+	case ColliderType::Box:
+		hit = IntersectRayOBB(origin, dir, p.obb, t);
+		break;
+	case ColliderType::Sphere:
+		hit = IntersectRaySphere(origin, dir, XMLoadFloat3(&p.sphere.center), p.sphere.radius, t);
+		break;
+	case ColliderType::Capsule:
+		hit = IntersectRayCapsule(origin, dir, p.capsule, t);
+		break;
+	case ColliderType::Cylinder:
+		hit = IntersectRayCylinder(origin, dir, p.cylinder, t);
+		break;
+	case ColliderType::Mesh:
+		if (const TriangleMesh* mesh = MeshOf(p.mesh)) {
+			XMFLOAT3 o, d;
+			XMStoreFloat3(&o, MeshPointToLocal(p.mesh, origin));
+			XMStoreFloat3(&d, MeshDirToLocal(p.mesh, dir));
+			hit = mesh->RayCast(o, d, FLT_MAX, t);
+		}
+		break;
+	}
+	return hit && t >= 0.0f;
+}
+
+void CollisionSystem::RaycastBatch(const std::vector<Physics::Ray>& rays, Physics::RayQuery query, std::vector<Physics::RayHit>& outHits)
+{
+	outHits.clear();
+	if (query != RayQuery::All) {
+		outHits.resize(rays.size());
+		for (uint32_t i = 0; i < (uint32_t)rays.size(); ++i) outHits[i] = { i, NullEntity, rays[i].maxDistance };
+	}
+	if (rays.empty()) return;
+
+	// --- 1. ̂BVHiUpdate ̍ŏ̖₢킹ōj ---
+	UpdateMovingBVH();
+
+	// --- 2. 4{ / 8{pPbgɂ܂Ƃ߂āABVHH ---
+	const uint32_t width = RayBatch::GetPacketWidth();
+	RayBatch::RayPacket packet;
+	for (size_t first = 0; first < rays.size(); first += width) {
+		const uint32_t count = (uint32_t)std::min<size_t>(width, rays.size() - first);
+		packet.active = 0;
+		for (uint32_t k = 0; k < count; ++k) {
+			const Physics::Ray& ray = rays[first + k];
+			packet.ox[k] = ray.origin.x;
+			packet.oy[k] = ray.origin.y;
+			packet.oz[k] = ray.origin.z;
+			packet.ix[k] = ray.direction.x != 0.0f ? 1.0f / ray.direction.x : INFINITY;
+			packet.iy[k] = ray.direction.y != 0.0f ? 1.0f / ray.direction.y : INFINITY;
+			packet.iz[k] = ray.direction.z != 0.0f ? 1.0f / ray.direction.z : INFINITY;
+			packet.tMax[k] = ray.maxDistance;
+			packet.active |= 1u << k;
+		}
+
+		// AABB ɓ[`Ɣ肷
+		auto visit = [&](const std::vector<CollisionProxy>& proxies) {
+			return [&](uint32_t item, uint32_t lanes) {
+				const CollisionProxy& p = proxies[item];
+				for (uint32_t k = 0; k < count; ++k) {
+					if (!(lanes & (1u << k))) continue;
+					const Physics::Ray& ray = rays[first + k];
+					if (p.isTrigger && !ray.hitTriggers) continue;
+					if ((ray.layerMask & LayerBit(p.layer)) == 0) continue;
+
+					float t = 0.0f;
+					if (!IntersectRayProxy(p, XMLoadFloat3(&ray.origin), XMLoadFloat3(&ray.direction), t)) continue;
+					if (t > packet.tMax[k]) continue;
+
+					const uint32_t index = (uint32_t)(first + k);
+					switch (query)
+					{
+					case RayQuery::Closest:
+						// ȂɌ
+						if (outHits[index].entity != NullEntity && t >= outHits[index].distance) break;
+						outHits[index].entity = p.entity;
+						outHits[index].distance = t;
+						packet.tMax[k] = t;
+						break;
+					case RayQuery::Any:
+						outHits[index].entity = p.entity;
+						outHits[index].distance = t;
+						packet.active &= ~(1u << k);
+						break;
+					case RayQuery::All:
+						outHits.push_back({ index, p.entity, t });
+						break;
+					}
+				}
+				};
+			};
+		m_staticBVH.RayCastPacket(packet, visit(m_staticProxies));
+		m_movingBVH.RayCastPacket(packet, visit(m_proxies));
+	}
+
+	if (query == RayQuery::All) {
+		std::sort(outHits.begin(), outHits.end(), [](const RayHit& a, const RayHit& b) {
+			if (a.ray != b.ray) return a.ray < b.ray;
+			if (a.distance != b.distance) return a.distance < b.distance;
+			return a.entity < b.entity;
+			});
+	}
+}
+
+void CollisionSystem::UpdateMovingBVH()
+{
+	if (!m_movingBVHDirty) return;
+
+	m_movingBounds.resize(m_proxies.size());
+	for (size_t i = 0; i < m_proxies.size(); ++i) m_movingBounds[i] = Inflate(m_proxies[i], RaySkin);
+	m_movingBVH.Build(m_movingBounds);
+	m_movingBVHDirty = false;
+}
+
+Entity CollisionSystem::RaycastClosest(const XMFLOAT3& rayOrigin, const XMFLOAT3& rayDir, float& outDist)
+{
+	m_singleRay.resize(1);
+	m_singleRay[0] = Physics::Ray{ rayOrigin, rayDir };
+	RaycastBatch(m_singleRay, RayQuery::Closest, m_singleHit);
+
+	outDist = m_singleHit[0].distance;
+	return m_singleHit[0].entity;
+}
+
+// =================================================================
+// dȂE`LXg
+// =================================================================
+
+// ₢킹p̌`̋ʕiǂ̃C[Ƃ Dynamic ƂĈj
+static CollisionProxy MakeQueryProxy(ColliderType type)
+{
+	CollisionProxy p = {};
+	p.entity = NullEntity;
+	p.type = type;
+	p.isTrigger = false;
+	p.bodyType = BodyType::Dynamic;
+	p.isSleeping = false;
+	p.layer = CollisionLayer::Default;
+	p.mask = 0xFFFFFFFFu;
+	return p;
+}
+
+CollisionProxy Physics::MakeSphereShape(const XMFLOAT3& center, float radius)
+{
+	CollisionProxy p = MakeQueryProxy(ColliderType::Sphere);
+	p.sphere.center = center;
+	p.sphere.radius = radius;
+	ComputeAABB(p);
+	return p;
+}
+
+CollisionProxy Physics::MakeBoxShape(const XMFLOAT3& center, const XMFLOAT3& halfExtents, const XMFLOAT4& rotation)
+{
+	CollisionProxy p = MakeQueryProxy(ColliderType::Box);
+	p.obb.center = center;
+	p.obb.extents = halfExtents;
+	XMFLOAT4X4 rotM; XMStoreFloat4x4(&rotM, XMMatrixRotationQuaternion(XMLoadFloat4(&rotation)));
+	p.obb.axes[0] = { rotM._11, rotM._12, rotM._13 };
+	p.obb.axes[1] = { rotM._21, rotM._22, rotM._23 };
+	p.obb.axes[2] = { rotM._31, rotM._32, rotM._33 };
+	ComputeAABB(p);
+	return p;
+}
+
+CollisionProxy Physics::MakeCapsuleShape(const XMFLOAT3& start, const XMFLOAT3& end, float radius)
+{
+	CollisionProxy p = MakeQueryProxy(ColliderType::Capsule);
+	p.capsule.start = start;
+	p.capsule.end = end;
+	p.capsule.radius = radius;
+	ComputeAABB(p);
+	return p;
+}
+
+size_t CollisionSystem::OverlapSphere(const XMFLOAT3& center, float radius, Entity* results, size_t capacity, const Physics::QueryFilter& filter)
+{
+	size_t count = 0;
+	Overlap(MakeSphereShape(center, radius), filter, [&](Entity e) {
+		if (count < capacity) results[count] = e;
+		++count;
+		});
+	return count;
+}
+
+size_t CollisionSystem::OverlapBox(const XMFLOAT3& center, const XMFLOAT3& halfExtents, const XMFLOAT4& rotation, Entity* results, size_t capacity, const Physics::QueryFilter& filter)
+{
+	size_t count = 0;
+	Overlap(MakeBoxShape(center, halfExtents, rotation), filter, [&](Entity e) {
+		if (count < capacity) results[count] = e;
+		++count;
+		});
+	return count;
+}
+
+size_t CollisionSystem::OverlapCapsule(const XMFLOAT3& start, const XMFLOAT3& end, float radius, Entity* results, size_t capacity, const Physics::QueryFilter& filter)
+{
+	size_t count = 0;
+	Overlap(MakeCapsuleShape(start, end, radius), filter, [&](Entity e) {
+		if (count < capacity) results[count] = e;
+		++count;
+		});
+	return count;
+}
+
+bool CollisionSystem::ShapeCast(const Physics::CollisionProxy& shape, const XMFLOAT3& direction, float maxDistance,
+	Physics::ShapeHit& outHit, const Physics::QueryFilter& filter)
+{
+	outHit = Physics::ShapeHit();
+	if (maxDistance <= 0.0f) return false;
+	UpdateMovingBVH();
+
+	// --- 1. ʂ蓹Ŝ͂AABBŌi ---
+	XMVECTOR disp = XMLoadFloat3(&direction) * maxDistance;
+	XMFLOAT3 d; XMStoreFloat3(&d, disp);
+	Physics::CollisionProxy end = shape;
+	TranslateProxy(end, disp);
+	const Physics::AABB swept = {
+		{ std::min(shape.aabbMin.x, end.aabbMin.x), std::min(shape.aabbMin.y, end.aabbMin.y), std::min(shape.aabbMin.z, end.aabbMin.z) },
+		{ std::max(shape.aabbMax.x, end.aabbMax.x), std::max(shape.aabbMax.y, end.aabbMax.y), std::max(shape.aabbMax.z, end.aabbMax.z) }
+	};
+
+	// --- 2. ₲ƂɍŏɐG銄𒲂ׁAԎÔ̂c ---
+	float best = 1.0f;
+	const Physics::CollisionProxy* hit = nullptr;
+	auto test = [&](const Physics::CollisionProxy& target) {
+		if (!Physics::PassesFilter(target, filter)) return;
+
+		Physics::Contact contact;
+		if (TestPair(shape, target, contact)) {
+			// n߂dȂĂ
+			if (best > 0.0f || !hit) { best = 0.0f; hit = &target; }
+			return;
+		}
+		if (best <= 0.0f) return;
+
+		float toi = SweepProxy(shape, d, target, best, 0.0f);
+		if (toi < best) { best = toi; hit = &target; }
+		};
+	m_staticBVH.Query(swept, [&](uint32_t item) { test(m_staticProxies[item]); });
+	m_movingBVH.Query(swept, [&](uint32_t item) { test(m_proxies[item]); });
+	if (!hit) return false;
+
+	// --- 3. GꂽʒuŔ肵Ėʂ̌ ---
+	Physics::CollisionProxy probe = shape;
+	TranslateProxy(probe, disp * best);
+	Physics::Contact contact;
+	if (TestPair(probe, *hit, contact)) {
+		outHit.normal = { -contact.normal.x, -contact.normal.y, -contact.normal.z };
+	}
+	else {
+		XMStoreFloat3(&outHit.normal, -XMLoadFloat3(&direction));
+	}
+	outHit.entity = hit->entity;
+	outHit.distance = best * maxDistance;
+	return true;
+}
+
 // =================================================================
 // ֐Q
 // =================================================================
@@ -383,16 +979,17 @@ bool CollisionSystem::CheckSphereOBB(const Physics::Sphere& s, const Physics::OB
 	if (dist < 1e-4f) {
 		// SOBBɂꍇFł󂢖ʂ։o
 		// (ȈՓIɋSOBBSւ̃xNggAeʂƂ̋𑪂)
-		// ł͊ȈՓIɁAOBB̒S狅̒Sւ̃xNg̗p
+		// ł͊ȈՓIɁA̒SOBB̒Sւ̃xNg̗p
 		XMVECTOR obbCenter = XMLoadFloat3(&b.center);
-		normal = sphereCenter - obbCenter;
-		if (LengthSq(normal) < 1e-4f) normal = XMVectorSet(0, 1, 0, 0);
+		normal = obbCenter - sphereCenter;
+		// SdȂ狅։oi@͋ -> OBB Ȃ̂ŉj
+		if (LengthSq(normal) < 1e-4f) normal = XMVectorSet(0, -1, 0, 0);
 		normal = XMVector3Normalize(normal);
 		// [x͐mɂ́uZ + avAȈՌvZ
 		outContact.depth = s.radius;
 	}
 	else {
-		normal = -distVec / dist; // A(Sphere) -> B(OBB)
+		normal = distVec / dist; // A(Sphere) -> B(OBB)
 		outContact.depth = s.radius - dist;
 	}
 
@@ -491,338 +1088,1124 @@ bool CollisionSystem::CheckOBBOBB(const Physics::OBB& a, const Physics::OBB& b,
 }
 
 // OBB vs Capsule (SATx[X)
-bool CollisionSystem::CheckOBBCapsule(const Physics::OBB& box, const Physics::Capsule& cap, Physics::Contact& outContact) {
-	// JvZuatvƂSATŔ
-	XMVECTOR centerA = XMLoadFloat3(&box.center);
-	// JvZS
-	XMVECTOR capStart = XMLoadFloat3(&cap.start);
-	XMVECTOR capEnd = XMLoadFloat3(&cap.end);
-	XMVECTOR capAxis = capEnd - capStart;
-	XMVECTOR centerB = (capStart + capEnd) * 0.5f;
-	XMVECTOR translation = centerB - centerA;
+// Capsule vs Capsule
+bool CollisionSystem::CheckCapsuleCapsule(const Physics::Capsule& a, const Physics::Capsule& b, Physics::Contact& outContact) {
+	XMVECTOR a1 = XMLoadFloat3(&a.start);
+	XMVECTOR a2 = XMLoadFloat3(&a.end);
+	XMVECTOR b1 = XMLoadFloat3(&b.start);
+	XMVECTOR b2 = XMLoadFloat3(&b.end);
 
-	XMVECTOR axesA[3] = { XMLoadFloat3(&box.axes[0]), XMLoadFloat3(&box.axes[1]), XMLoadFloat3(&box.axes[2]) };
-	float extA[3] = { box.extents.x, box.extents.y, box.extents.z };
+	XMVECTOR c1, c2; // ̍ŋߐړ_
+	float distSq = SegmentSegmentDistanceSq(a1, a2, b1, b2, c1, c2);
+	float rSum = a.radius + b.radius;
 
-	float minOverlap = FLT_MAX;
-	XMVECTOR mtvAxis = XMVectorSet(0, 1, 0, 0);
+	if (distSq >= rSum * rSum) return false;
 
-	auto TestAxis = [&](XMVECTOR axis) -> bool {
-		if (LengthSq(axis) < 1e-6f) return true;
-		axis = XMVector3Normalize(axis);
+	float dist = std::sqrt(distSq);
+	XMVECTOR normal;
 
-		// Box̓e
-		float rA = extA[0] * std::abs(XMVectorGetX(XMVector3Dot(axesA[0], axis))) +
-			extA[1] * std::abs(XMVectorGetX(XMVector3Dot(axesA[1], axis))) +
-			extA[2] * std::abs(XMVectorGetX(XMVector3Dot(axesA[2], axis)));
+	if (dist < 1e-4f) {
+		normal = XMVectorSet(0, 1, 0, 0);
+		dist = 0.0f;
+	}
+	else {
+		normal = (c2 - c1) / dist; // A -> B
+	}
 
-		// Capsule̓e: (/2 * cos) + a
-		float rB = (XMVectorGetX(XMVector3Length(capAxis)) * 0.5f) * std::abs(XMVectorGetX(XMVector3Dot(XMVector3Normalize(capAxis), axis))) +
-			cap.radius;
+	XMStoreFloat3(&outContact.normal, normal);
+	outContact.depth = rSum - dist;
+	return true;
+}
 
-		float dist = std::abs(XMVectorGetX(XMVector3Dot(translation, axis)));
-		float overlap = (rA + rB) - dist;
+// Mesh vs ʌ`
+bool CollisionSystem::CheckMesh(const Physics::MeshInstance& m, const CollisionProxy& shape, Physics::Contact& outContact) {
+	const TriangleMesh* mesh = MeshOf(m);
+	if (!mesh) return false;
 
-		if (overlap < 0) return false;
-		if (overlap < minOverlap) {
-			minOverlap = overlap;
-			mtvAxis = axis;
-			if (XMVectorGetX(XMVector3Dot(translation, axis)) < 0) mtvAxis = -axis;
+	// ʂ̖@ƂȏセĂ΁AOp`̖ʁiE_łȂjœĂ
+	constexpr float FaceAlignment = 0.9999f;
+
+	struct TriangleHit
+	{
+		XMFLOAT3 a, b, c;	// [hԂ̒_
+		XMFLOAT3 normal;
+		float depth;
+		bool face;
+	};
+	// dȂOp`͑Sgi[J[ƂɎg񂵁A͊mۂȂj
+	thread_local std::vector<TriangleHit> hits;
+	hits.clear();
+
+	// --- 1. AABBfԂɈڂABVH ŏdȂOp`T ---
+	Physics::AABB local = MeshLocalBounds(m, shape.aabbMin, shape.aabbMax);
+	XMMATRIX world = MeshMatrix(m);
+
+	// --- 2. Op`ƂɔiOp`͗ʁj ---
+	mesh->Query(local, [&](uint32_t triangle) {
+		XMFLOAT3 a, b, c;
+		mesh->GetTriangle(triangle, a, b, c);
+		XMVECTOR wa = XMVector3TransformCoord(XMLoadFloat3(&a), world);
+		XMVECTOR wb = XMVector3TransformCoord(XMLoadFloat3(&b), world);
+		XMVECTOR wc = XMVector3TransformCoord(XMLoadFloat3(&c), world);
+		Physics::Contact hit;
+		if (!Physics::CollideTriangle(wa, wb, wc, shape, hit)) return;
+
+		TriangleHit h;
+		XMStoreFloat3(&h.a, wa);
+		XMStoreFloat3(&h.b, wb);
+		XMStoreFloat3(&h.c, wc);
+		XMVECTOR face = XMVector3Normalize(XMVector3Cross(wb - wa, wc - wa));
+		h.normal = hit.normal;
+		h.depth = hit.depth;
+		h.face = std::abs(XMVectorGetX(XMVector3Dot(face, XMLoadFloat3(&hit.normal)))) >= FaceAlignment;
+		hits.push_back(h);
+		});
+	if (hits.empty()) return false;
+
+	// --- 3. ʂœĂOp`oΈꏏɔ鉏E_͎̓̂Ă ---
+	// iȏ̌pڂŁAׂ̎Op`̉ɈȂ悤Ɂj
+	XMVECTOR weighted = XMVectorZero();
+	XMVECTOR deepestNormal = XMVectorZero();
+	float deepest = -1.0f;
+	for (auto& h : hits) {
+		XMVECTOR n = XMLoadFloat3(&h.normal);
+		if (!h.face) {
+			bool covered = false;
+			for (const auto& f : hits) {
+				if (f.face && f.depth * XMVectorGetX(XMVector3Dot(n, XMLoadFloat3(&f.normal))) >= h.depth) { covered = true; break; }
+			}
+			if (covered) { h.depth = 0.0f; continue; }
 		}
-		return true;
+		weighted += n * h.depth;
+		if (h.depth > deepest) { deepest = h.depth; deepestNormal = n; }
+	}
+
+	// --- 4. 1̐ڐGɂ܂Ƃ߂igƂɐڐG1j ---
+	// @͐[ŏd݂t
+	XMVECTOR normal = deepestNormal;
+	float length = XMVectorGetX(XMVector3Length(weighted));
+	if (length > 1e-6f) normal = weighted / length;
+
+	// [ normal ̌ɉɊeOp`甲鋗̍ő
+	// Op`ƂɁA u ̓ȅdȂ / (uEnormal) ԏ́iǂ u ł̋ u ̓ej
+	// u  normal gEOp`̖ʂ̖@iɕɏĂ鎞͂傤ǁjEOp`Ƃ̐ڐG̖@
+	auto overlap = [&](const TriangleHit& h, FXMVECTOR u) {
+		float triMax = std::max({
+			XMVectorGetX(XMVector3Dot(XMLoadFloat3(&h.a), u)),
+			XMVectorGetX(XMVector3Dot(XMLoadFloat3(&h.b), u)),
+			XMVectorGetX(XMVector3Dot(XMLoadFloat3(&h.c), u)) });
+		float shapeMin = XMVectorGetX(XMVector3Dot(Physics::SupportCore(shape, -u), u)) - Physics::CoreRadius(shape);
+		return triMax - shapeMin;
+	};
+	float depth = 0.0f;
+	for (const auto& h : hits) {
+		if (h.depth <= 0.0f) continue;
+		float along = XMVectorGetX(XMVector3Dot(normal, XMLoadFloat3(&h.normal)));
+		if (along <= 0.0f) continue;	// Όi񂾗̎Op`j
+
+		float exit = std::min(overlap(h, normal), h.depth / along);
+		XMVECTOR a = XMLoadFloat3(&h.a);
+		XMVECTOR face = XMVector3Normalize(XMVector3Cross(XMLoadFloat3(&h.b) - a, XMLoadFloat3(&h.c) - a));
+		float faceAlong = XMVectorGetX(XMVector3Dot(face, normal));
+		if (faceAlong < 0.0f) { face = -face; faceAlong = -faceAlong; }
+		if (faceAlong > 1e-4f) exit = std::min(exit, overlap(h, face) / faceAlong);
+		depth = std::max(depth, exit);
+	}
+	if (depth <= 0.0f) {
+		normal = deepestNormal;
+		depth = deepest;
+	}
+
+	XMStoreFloat3(&outContact.normal, normal);
+	outContact.depth = depth;
+	return true;
+}
+
+// =================================================================
+// i[tF[Yi`̑gݍ킹Ƃ̐U蕪j
+// =================================================================
+bool CollisionSystem::TestPair(const CollisionProxy& A, const CollisionProxy& B, Physics::Contact& contact, Physics::SimplexCache* cache) {
+	contact.a = A.entity;
+	contact.b = B.entity;
+	bool hit = false;
+
+	auto flip = [&contact]() { contact.normal.x *= -1; contact.normal.y *= -1; contact.normal.z *= -1; };
+
+	// Sphere vs ...
+	if (A.type == ColliderType::Sphere && B.type == ColliderType::Sphere)
+		hit = CheckSphereSphere(A.sphere, B.sphere, contact);
+	else if (A.type == ColliderType::Sphere && B.type == ColliderType::Box)
+		hit = CheckSphereOBB(A.sphere, B.obb, contact);
+	else if (A.type == ColliderType::Box && B.type == ColliderType::Sphere) {
+		hit = CheckSphereOBB(B.sphere, A.obb, contact);
+		if (hit) flip();
+	}
+	else if (A.type == ColliderType::Sphere && B.type == ColliderType::Capsule)
+		hit = CheckSphereCapsule(A.sphere, B.capsule, contact);
+	else if (A.type == ColliderType::Capsule && B.type == ColliderType::Sphere) {
+		hit = CheckSphereCapsule(B.sphere, A.capsule, contact);
+		if (hit) flip();
+	}
+
+	// Box vs Box
+	else if (A.type == ColliderType::Box && B.type == ColliderType::Box)
+		hit = CheckOBBOBB(A.obb, B.obb, contact);
+
+	// Capsule vs Capsule
+	else if (A.type == ColliderType::Capsule && B.type == ColliderType::Capsule)
+		hit = CheckCapsuleCapsule(A.capsule, B.capsule, contact);
+
+	// Mesh vs ...i@ mesh -> BMesh m͔肵Ȃj
+	else if (A.type == ColliderType::Mesh || B.type == ColliderType::Mesh) {
+		if (A.type == ColliderType::Mesh && B.type != ColliderType::Mesh)
+			hit = CheckMesh(A.mesh, B, contact);
+		else if (B.type == ColliderType::Mesh && A.type != ColliderType::Mesh) {
+			hit = CheckMesh(B.mesh, A, contact);
+			if (hit) flip();
+		}
+	}
+
+	// ȊOiƃJvZE~܂ޑgE㑝ʌ`j̓T|[g֐Ŕ
+	else
+		hit = Physics::CollideGJK(A, B, contact, cache);
+
+	return hit;
+}
+
+// =================================================================
+// CXV[v
+// =================================================================
+void CollisionSystem::Update(Registry& registry) {
+	Physics::Determinism& determinism = Physics::Determinism::Instance();
+	if (!determinism.IsEnabled()) {
+		Step(registry, Time::DeltaTime());
+		return;
+	}
+
+	// _[hF܂Ԃ̕ ϕ -> svZ -> Ɖ Œ dt ŌJԂ
+	const int steps = determinism.ConsumeSteps(Time::DeltaTime());
+	m_frameEvents.clear();
+	for (int i = 0; i < steps; ++i) {
+		m_fixedPhysics.Step(registry, Physics::Determinism::FixedDeltaTime);
+		m_fixedHierarchy.Update(registry);
+		Step(registry, Physics::Determinism::FixedDeltaTime);
+		m_frameEvents.insert(m_frameEvents.end(), m_events.begin(), m_events.end());
+	}
+	m_events.swap(m_frameEvents);
+}
+
+void CollisionSystem::Step(Registry& registry, float dt)
+{
+	// iKƂ̎ԁivEmFpj
+	using Clock = std::chrono::high_resolution_clock;
+	auto lap = [last = Clock::now()](double& outMs) mutable {
+		Clock::time_point now = Clock::now();
+		outMs = std::chrono::duration<double, std::milli>(now - last).count();
+		last = now;
 		};
 
-	// Box̖ʖ@ (3)
-	for (int i = 0; i < 3; ++i) if (!TestAxis(axesA[i])) return false;
+	// --- 1. vLV쐬 ---
+	m_islands.BeginStep();
+	BuildProxies(registry);
+	m_movingBVHDirty = true;
 
-	// Capsule̎Ƃ̊O (3)
-	for (int i = 0; i < 3; ++i) if (!TestAxis(XMVector3Cross(axesA[i], capAxis))) return false;
+	// --- 2. AîǂɍŏɐGꂽʒu܂Ŗ߂j ---
+	ApplyContinuous(registry, dt);
+	lap(m_timings.proxyMs);
 
-	// [_Box̍ŋߐړ_ (Crossςł̓GbWvsGbWȂ)
-	// ȈՓIɁu vs OBBṽWbNĕ⊮
-	// iSAT݂̂Ŕ肵Aŋߐړ_x[X̎͏ȗj
+	// --- 3. u[htF[Yi̓m̌yAij ---
+	m_broadphase->Update(m_proxies, m_pairs);
+	lap(m_timings.broadphaseMs);
 
-	// Box(A) -> Capsule(B)
-	XMStoreFloat3(&outContact.normal, mtvAxis);
-	outContact.depth = minOverlap;
-	return true;
+	// --- 4. i[tF[Y ---
+	RunNarrowPhase();
+	lap(m_timings.narrowPhaseMs);
+
+	// --- 5. Ă铇NiNĂ̂GꂽEONꂽj ---
+	m_islands.WakeTouched(registry, m_proxies, m_contacts, dt);
+
+	// --- 6. ڐG̉ ---
+	m_solver.Solve(registry, m_contacts);
+	lap(m_timings.solveMs);
+
+	// --- 7. ~܂Ă铇𖰂点 ---
+	m_islands.UpdateSleep(registry, m_proxies, m_contacts, dt);
+
+	// --- 8. gK[EڐGCxg ---
+	UpdateEvents(registry);
+
+	// --- 9. _[hł͏Ԃ̃`FbNTivCEsƂ̔rpj ---
+	if (Physics::Determinism::Instance().IsEnabled()) {
+		m_stateChecksum = Physics::ComputeStateChecksum(registry, m_checksumScratch);
+	}
+	lap(m_timings.otherMs);
 }
 
-bool CollisionSystem::CheckOBBCylinder(const Physics::OBB& box, const Physics::Cylinder& cyl, Physics::Contact& outContact)
+// ÓILbVmFẪvLV̂ς̂蒼
+void CollisionSystem::BuildProxies(Registry& registry)
 {
-	XMVECTOR boxCenter = XMLoadFloat3(&box.center);
-	XMVECTOR boxAxes[3] = { XMLoadFloat3(&box.axes[0]), XMLoadFloat3(&box.axes[1]), XMLoadFloat3(&box.axes[2]) };
-	float boxExtents[3] = { box.extents.x, box.extents.y, box.extents.z };
+	// --- 1. ÓIȓ蔻̊mFiǉE폜EҏWEړj ---
+	const uint64_t revisions[4] = {
+		registry.revision<Transform>(), registry.revision<Collider>(),
+		registry.revision<Rigidbody>(), registry.revision<Relationship>()
+	};
+	bool refreshed = false;
+	// XNvgȂǂ patch Ă΂ɐÓIȓ蔻𓮂ꍇAHierarchySystem ̈󂩂猩č蒼
+	// i͖t[󂯎ďj
+	const bool staticMoved = StaticMoved(registry);
+	if (!std::equal(std::begin(revisions), std::end(revisions), std::begin(m_revisions)) || staticMoved || StaticMeshChanged()) {
+		// Rigidbody OꂽiEntity 폜ꂽĵ𖰂Ă铇O
+		if (revisions[2] != m_revisions[2]) m_islands.RemoveDestroyed(registry);
+
+		// ÓIȓ蔻肪ςAꂪEȂ̂ŖĂ铇SċN
+		const size_t staticBuilds = m_staticRebuildCount;
+		RefreshStatic(registry);
+		if (m_staticRebuildCount != staticBuilds) m_islands.WakeAll(registry);
+		std::copy(std::begin(revisions), std::end(revisions), std::begin(m_revisions));
+		refreshed = true;
+	}
 
-	XMVECTOR cylCenter = XMLoadFloat3(&cyl.center);
-	XMVECTOR cylAxis = XMLoadFloat3(&cyl.axis);
-	XMVECTOR translation = cylCenter - boxCenter;
+	// --- 2. ̂̈ꗗςĂ΁AÕvLV Entity ňpŕג ---
+	if (refreshed) {
+		m_proxyScratch.resize(m_moving.size());
+		m_sourceScratch.resize(m_moving.size());
+		for (size_t i = 0; i < m_moving.size(); ++i) {
+			Entity e = m_moving[i];
+			uint32_t slot = e < m_proxySlot.size() ? m_proxySlot[e] : 0xFFFFFFFFu;
+			if (slot < m_proxies.size() && m_proxies[slot].entity == e) {
+				m_proxyScratch[i] = m_proxies[slot];
+				m_sourceScratch[i] = m_proxySources[slot];
+			}
+			else {
+				m_proxyScratch[i].entity = NullEntity;
+				m_sourceScratch[i].valid = false;
+			}
+		}
+		m_proxies.swap(m_proxyScratch);
+		m_proxySources.swap(m_sourceScratch);
 
-	float minOverlap = FLT_MAX;
-	XMVECTOR mtvAxis = XMVectorSet(0, 1, 0, 0);
+		for (size_t i = 0; i < m_moving.size(); ++i) {
+			Entity e = m_moving[i];
+			if (e >= m_proxySlot.size()) m_proxySlot.resize((size_t)e + 1, 0xFFFFFFFFu);
+			m_proxySlot[e] = (uint32_t)i;
+		}
+	}
 
-	auto TestAxis = [&](XMVECTOR axis) -> bool {
-		if (LengthSq(axis) < 1e-6f) return true;
-		axis = XMVector3Normalize(axis);
+	// --- 3. [hs Collider ς̂vLV蒼 ---
+	// 폜EǉΏ m_moving 蒼̂ŁAł͕K Transform  Collider Ă
+	// ςȂ AABB Ȃ̂ŁAu[htF[YłtւȂ
+	for (Entity e : m_sleepingProxies) m_sleepFlags[e] = 0;
+	m_sleepingProxies.clear();
+	m_proxyRebuilds = 0;
+	const uint64_t meshGeneration = Physics::TriangleMeshLibrary::Instance().GetGeneration();
+	const uint64_t modelRevision = Physics::TriangleMeshLibrary::Instance().GetModelRevision();
+
+	for (size_t i = 0; i < m_moving.size(); ++i) {
+		Entity e = m_moving[i];
+		const Transform& t = registry.get<Transform>(e);
+		const Collider& c = registry.get<Collider>(e);
+		Rigidbody* rb = registry.has<Rigidbody>(e) ? &registry.get<Rigidbody>(e) : nullptr;
+		const BodyType bodyType = rb ? rb->type : BodyType::Static;
+		auto& proxy = m_proxies[i];
+		auto& source = m_proxySources[i];
+
+		XMFLOAT4X4 world;
+		XMStoreFloat4x4(&world, t.worldMatrix);
+
+		const bool unchanged = source.valid && proxy.entity == e && proxy.bodyType == bodyType &&
+			std::memcmp(&world, &source.world, sizeof(XMFLOAT4X4)) == 0 && SameCollider(c, source.collider) &&
+			// Op`o^ĂȂiǂ߂ĂȂf́AfVǂݍ܂ꂽǂݒĂ݂j
+			(c.type != ColliderType::Mesh || (source.meshGeneration == meshGeneration &&
+				(proxy.mesh.mesh != Physics::InvalidMeshId || source.modelRevision == modelRevision)));
+
+		bool sleeping = rb && rb->isSleeping;
+		if (!unchanged) {
+			// ĂԂɓꂽiGfB^EXNvgj
+			// ̃t[́A\o[œ̈ʒuō蒼Ăg
+			if (sleeping && proxy.entity == e && proxy.isSleeping) {
+				m_islands.Wake(registry, e);
+				sleeping = false;
+			}
+			BuildProxy(e, t, c, bodyType, proxy);
+			source.world = world;
+			source.collider = c;
+			source.meshGeneration = Physics::TriangleMeshLibrary::Instance().GetGeneration();
+			source.modelRevision = modelRevision;
+			source.valid = true;
+			++m_proxyRebuilds;
+		}
+
+		proxy.isSleeping = sleeping;
+		if (sleeping) {
+			if (e >= m_sleepFlags.size()) m_sleepFlags.resize((size_t)e + 1, 0);
+			m_sleepFlags[e] = 1;
+			m_sleepingProxies.push_back(e);
+		}
+	}
+}
 
-		// Box Projection
-		float rBox = boxExtents[0] * std::abs(XMVectorGetX(XMVector3Dot(boxAxes[0], axis))) +
-			boxExtents[1] * std::abs(XMVectorGetX(XMVector3Dot(boxAxes[1], axis))) +
-			boxExtents[2] * std::abs(XMVectorGetX(XMVector3Dot(boxAxes[2], axis)));
+// =================================================================
+// AiCCDj
+// =================================================================
 
-		// Cylinder Projection
-		// ~̎ˉea = (/2 * |cos|) + (a * |sin|)
-		// |cos| = |dot(axis, cylAxis)|
-		// |sin| = |cross(axis, cylAxis)| ̒
-		float rCylH = (cyl.height * 0.5f) * std::abs(XMVectorGetX(XMVector3Dot(cylAxis, axis)));
-		float rCylR = cyl.radius * std::sqrt(XMVectorGetX(XMVector3LengthSq(XMVector3Cross(axis, cylAxis))));
-		float rCyl = rCylH + rCylR;
+// PhysicsSystem  velocity * dt ʒui߂̂ŁA̒ʂ蓹ÓIȓ蔻ɑ΂Ēׂ
+// ǂɍŏɐGꂽʒui߂荞܂j܂Ŗ߂ƁÃt[̃i[tF[YŐڐGɂȂA\o[x~߂
+void CollisionSystem::ApplyContinuous(Registry& registry, float dt)
+{
+	// 傫̉葽Aw肪ĂA肷邩
+	constexpr float MotionFraction = 0.5f;
+	// Gꂽʒu炳ɐi߂߂荞 [m]iڂĂ邾ƋEŔ肪O邱Ƃj
+	constexpr float Skin = 0.005f;
+
+	m_continuousHits = 0;
+	if (dt <= 0.0f || m_staticProxies.empty()) return;
+
+	const Physics::LayerMatrix& layers = Physics::LayerMatrix::Instance();
+	for (auto& proxy : m_proxies) {
+		if (proxy.bodyType != BodyType::Dynamic || proxy.isSleeping || proxy.isTrigger) continue;
+
+		// eɘAē̂́AxƎۂ̈ړʂvȂ̂őΏۊO
+		Entity e = proxy.entity;
+		if (registry.has<Relationship>(e) && registry.get<Relationship>(e).parent != NullEntity) continue;
+
+		const Rigidbody& rb = registry.get<Rigidbody>(e);
+		XMVECTOR disp = XMLoadFloat3(&rb.velocity) * dt;
+		float distance = XMVectorGetX(XMVector3Length(disp));
+		if (distance <= 0.0f) continue;
+		if (!rb.continuous && distance <= MinHalfSize(proxy) * MotionFraction) continue;
+
+		// ÕvLVƁAʂ蓹Ŝ͂AABB
+		Physics::CollisionProxy start = proxy;
+		TranslateProxy(start, -disp);
+		Physics::AABB swept = {
+			{ std::min(start.aabbMin.x, proxy.aabbMin.x), std::min(start.aabbMin.y, proxy.aabbMin.y), std::min(start.aabbMin.z, proxy.aabbMin.z) },
+			{ std::max(start.aabbMax.x, proxy.aabbMax.x), std::max(start.aabbMax.y, proxy.aabbMax.y), std::max(start.aabbMax.z, proxy.aabbMax.z) }
+		};
 
-		float dist = std::abs(XMVectorGetX(XMVector3Dot(translation, axis)));
-		float overlap = (rBox + rCyl) - dist;
+		XMFLOAT3 d; XMStoreFloat3(&d, disp);
+		float toi = 1.0f;
+		m_staticBVH.Query(swept, [&](uint32_t item) {
+			const auto& B = m_staticProxies[item];
+			if (B.isTrigger || !Physics::ShouldCollide(proxy, B, layers)) return;
+			toi = std::min(toi, SweepProxy(start, d, B, toi, Skin));
+			});
+		if (toi >= 1.0f) continue;
+
+		// ŏɐGꂽʒu܂Ŗ߂i[gȂ̂Ń[JW = [hWj
+		XMVECTOR back = disp * (toi - 1.0f);
+		TranslateProxy(proxy, back);
+		Transform& t = registry.get<Transform>(e);
+		XMStoreFloat3(&t.position, XMLoadFloat3(&t.position) + back);
+		XMStoreFloat3(&t.worldPosition, XMLoadFloat3(&t.worldPosition) + back);
+		t.worldMatrix.r[3] = XMVectorAdd(t.worldMatrix.r[3], back);
+		++m_continuousHits;
+	}
+}
 
-		if (overlap < 0) return false;
-		if (overlap < minOverlap) {
-			minOverlap = overlap;
-			mtvAxis = axis;
-			if (XMVectorGetX(XMVector3Dot(translation, axis)) < 0) mtvAxis = -axis;
+float CollisionSystem::SweepProxy(const Physics::CollisionProxy& start, const XMFLOAT3& dispF, const Physics::CollisionProxy& target, float limit, float skin)
+{
+	// ׂԂɕĐi߂邩iׂقǊp߂邾̓щzɂjƁA񕪒T̉
+	constexpr int MinSteps = 32;
+	constexpr int MaxSteps = 64;
+	constexpr int Refinements = 8;
+
+	XMVECTOR disp = XMLoadFloat3(&dispF);
+	Physics::Contact contact;
+
+	// OdȂĂ̂́Aʂ̐ڐGƂĉoɔC
+	if (TestPair(start, target, contact)) return 1.0f;
+
+	// --- 0. AABBmdȂĂ銄̋Ԃ𒲂ׂiAABB̔̑傫c܂Xu@j ---
+	float enter = 0.0f, exit = limit;
+	{
+		const float c[3] = { (start.aabbMin.x + start.aabbMax.x) * 0.5f, (start.aabbMin.y + start.aabbMax.y) * 0.5f, (start.aabbMin.z + start.aabbMax.z) * 0.5f };
+		const float h[3] = { (start.aabbMax.x - start.aabbMin.x) * 0.5f, (start.aabbMax.y - start.aabbMin.y) * 0.5f, (start.aabbMax.z - start.aabbMin.z) * 0.5f };
+		const float mn[3] = { target.aabbMin.x, target.aabbMin.y, target.aabbMin.z };
+		const float mx[3] = { target.aabbMax.x, target.aabbMax.y, target.aabbMax.z };
+		const float d[3] = { dispF.x, dispF.y, dispF.z };
+		for (int k = 0; k < 3; ++k) {
+			float lo = mn[k] - h[k] - c[k];
+			float hi = mx[k] + h[k] - c[k];
+			if (std::abs(d[k]) < 1e-12f) {
+				if (lo > 0.0f || hi < 0.0f) return 1.0f;
+				continue;
+			}
+			float t1 = lo / d[k], t2 = hi / d[k];
+			if (t1 > t2) std::swap(t1, t2);
+			enter = std::max(enter, t1);
+			exit = std::min(exit, t2);
 		}
-		return true;
+		if (enter > exit) return 1.0f;
+	}
+
+	// --- 1. EJvZ vs Fac܂ɁASiJvZ͐̓_j鎞܂ňCɐi߂ ---
+	// c܂͊pۂȂ傫̂ŁAŊOΓȂ
+	float first = enter;
+	if (target.type == ColliderType::Box && (start.type == ColliderType::Sphere || start.type == ColliderType::Capsule)) {
+		float boxEnter = FLT_MAX, t;
+		if (start.type == ColliderType::Sphere) {
+			if (SegmentEnterOBB(XMLoadFloat3(&start.sphere.center), disp, target.obb, start.sphere.radius, t)) boxEnter = t;
+		}
+		else {
+			// ɔaȉ̊Ԋuœ_ׂi̗ŃJvZ𕢂j
+			XMVECTOR a = XMLoadFloat3(&start.capsule.start);
+			XMVECTOR b = XMLoadFloat3(&start.capsule.end);
+			float length = XMVectorGetX(XMVector3Length(b - a));
+			int count = std::min(16, 1 + (int)std::ceil(length / std::max(start.capsule.radius, 1e-4f)));
+			for (int k = 0; k <= count; ++k) {
+				XMVECTOR p = XMVectorLerp(a, b, (float)k / count);
+				if (SegmentEnterOBB(p, disp, target.obb, start.capsule.radius, t)) boxEnter = std::min(boxEnter, t);
+			}
+		}
+		if (boxEnter >= exit) return 1.0f;
+		first = std::max(first, boxEnter);
+	}
+
+	// --- 2. ̌`̈ԍׂi߂ďdȂTiێIOiBԂ MinSteps ` MaxSteps ɕj ---
+	float distance = XMVectorGetX(XMVector3Length(disp));
+	float window = exit - first;
+	float step = std::clamp(std::min(MinHalfSize(start), MinHalfSize(target)) / distance, window / MaxSteps, window / MinSteps);
+	if (step <= 0.0f) step = 1.0f / MaxSteps;
+
+	Physics::CollisionProxy probe;
+	auto overlapsAt = [&](float t) {
+		probe = start;
+		TranslateProxy(probe, disp * t);
+		return TestPair(probe, target, contact);
 		};
 
-	// Box Axes
-	for (int i = 0; i < 3; ++i) if (!TestAxis(boxAxes[i])) return false;
+	float lo = 0.0f;
+	for (float t = first; ; t = std::min(t + step, exit)) {
+		if (overlapsAt(t)) {
+			// --- 3. dȂȂʒuƏdȂʒůԂ񕪒Tŏk߁AdȂ鑤i߂ĕԂ ---
+			float hi = t;
+			for (int i = 0; i < Refinements; ++i) {
+				float mid = (lo + hi) * 0.5f;
+				if (overlapsAt(mid)) hi = mid;
+				else lo = mid;
+			}
+			return std::min(hi + skin / distance, 1.0f);
+		}
+		lo = t;
+		if (t >= exit) break;
+	}
+	return 1.0f;
+}
 
-	// Cylinder Axis
-	if (!TestAxis(cylAxis)) return false;
+// i[tF[YiXbhƂ̃obt@ɔ肵AŌ Entity ̑g̏ɕׂj
+void CollisionSystem::RunNarrowPhase()
+{
+	// 1̎d̑傫iƔzԂ̕傫Ȃj
+	constexpr uint32_t PairBatch = 256;
+	constexpr uint32_t ProxyBatch = 64;
+
+	JobSystem& jobs = JobSystem::Instance();
+	const Physics::LayerMatrix& layers = Physics::LayerMatrix::Instance();
+	uint32_t threadCount = jobs.GetThreadCount();
+	if (m_threadContacts.size() < threadCount) m_threadContacts.resize(threadCount);
+	if (m_threadBuckets.size() < threadCount) m_threadBuckets.resize(threadCount);
+	if (m_threadTriggers.size() < threadCount) m_threadTriggers.resize(threadCount);
+	if (m_threadSimplices.size() < threadCount) m_threadSimplices.resize(threadCount);
+	for (auto& buffer : m_threadContacts) buffer.clear();
+	for (auto& buffer : m_threadTriggers) buffer.clear();
+	for (auto& buffer : m_threadSimplices) buffer.clear();
+
+	// --- 1. yAi̓mj ---
+	jobs.ParallelFor((uint32_t)m_pairs.size(), PairBatch, [&](uint32_t begin, uint32_t end, uint32_t thread) {
+		auto& out = m_threadContacts[thread];
+		auto& buckets = m_threadBuckets[thread];
+		auto& triggers = m_threadTriggers[thread];
+		auto& simplices = m_threadSimplices[thread];
+		for (uint32_t i = begin; i < end; ++i) {
+			// ǧiڐG̖@̌j̓u[htF[Yɂ炸 Entity ̏ A ɂ
+			const auto* pa = &m_proxies[m_pairs[i].first];
+			const auto* pb = &m_proxies[m_pairs[i].second];
+			if (pb->entity < pa->entity) std::swap(pa, pb);
+			const auto& A = *pa;
+			const auto& B = *pb;
+
+			// ȂiStaticEĂjg͔肵Ȃ
+			if (Physics::IsResting(A) && Physics::IsResting(B)) continue;
+			if (!Physics::ShouldCollide(A, B, layers)) continue;
+
+			DispatchPair(A, B, buckets, out, triggers, simplices);
+		}
+		FlushBuckets(buckets, out);
+		});
 
-	// Cross Products (Box axes x Cylinder axis)
-	for (int i = 0; i < 3; ++i) if (!TestAxis(XMVector3Cross(boxAxes[i], cylAxis))) return false;
+	// --- 2.  vs ÓIBVH ---
+	jobs.ParallelFor((uint32_t)m_proxies.size(), ProxyBatch, [&](uint32_t begin, uint32_t end, uint32_t thread) {
+		auto& out = m_threadContacts[thread];
+		auto& buckets = m_threadBuckets[thread];
+		auto& triggers = m_threadTriggers[thread];
+		auto& simplices = m_threadSimplices[thread];
+		for (uint32_t i = begin; i < end; ++i) {
+			const auto& A = m_proxies[i];
+			if (Physics::IsResting(A)) continue;
+
+			Physics::AABB aabb = { A.aabbMin, A.aabbMax };
+			m_staticBVH.Query(aabb, [&](uint32_t item) {
+				const auto& B = m_staticProxies[item];
+				if (!Physics::ShouldCollide(A, B, layers)) return;
+				DispatchPair(A, B, buckets, out, triggers, simplices);
+				});
+		}
+		FlushBuckets(buckets, out);
+		});
 
-	XMStoreFloat3(&outContact.normal, mtvAxis);
-	outContact.depth = minOverlap;
-	return true;
+	// --- 3. ܂Ƃ߂ĕׂiXbhzɂ炸ԂɂȂj ---
+	// g2o邱Ƃ͖̂ŁAEntity ̑gŏԂ1Ɍ܂
+	m_contacts.clear();
+	for (const auto& buffer : m_threadContacts) {
+		m_contacts.insert(m_contacts.end(), buffer.begin(), buffer.end());
+	}
+	std::sort(m_contacts.begin(), m_contacts.end(), [](const Physics::Contact& x, const Physics::Contact& y) {
+		return x.a != y.a ? x.a < y.a : x.b < y.b;
+		});
+
+	// --- 4. ̒P̂̃t[pɎci肵Ȃĝ͎Ăj ---
+	m_simplexCache.clear();
+	for (const auto& buffer : m_threadSimplices) {
+		m_simplexCache.insert(m_simplexCache.end(), buffer.begin(), buffer.end());
+	}
+	std::sort(m_simplexCache.begin(), m_simplexCache.end(), [](const Physics::CachedSimplex& x, const Physics::CachedSimplex& y) {
+		return x.key < y.key;
+		});
+
+	uint32_t iterations = 0;
+	for (const auto& entry : m_simplexCache) iterations += entry.simplex.iterations;
+	m_gjkAverageIterations = m_simplexCache.empty() ? 0.0f : (float)iterations / m_simplexCache.size();
 }
 
-// Capsule vs Capsule
-bool CollisionSystem::CheckCapsuleCapsule(const Physics::Capsule& a, const Physics::Capsule& b, Physics::Contact& outContact) {
-	XMVECTOR a1 = XMLoadFloat3(&a.start);
-	XMVECTOR a2 = XMLoadFloat3(&a.end);
-	XMVECTOR b1 = XMLoadFloat3(&b.start);
-	XMVECTOR b2 = XMLoadFloat3(&b.end);
+void CollisionSystem::DispatchPair(const Physics::CollisionProxy& A, const Physics::CollisionProxy& B,
+	Physics::PairBuckets& buckets, std::vector<Physics::Contact>& out, std::vector<uint64_t>& triggers,
+	std::vector<Physics::CachedSimplex>& simplices)
+{
+	// gK[͉oAdȂĂgo
+	if (A.isTrigger || B.isTrigger) {
+		Physics::Contact contact;
+		if (TestPair(A, B, contact)) triggers.push_back(Physics::PairSet::MakeKey(A.entity, B.entity));
+		return;
+	}
 
-	XMVECTOR c1, c2; // ̍ŋߐړ_
-	float distSq = SegmentSegmentDistanceSq(a1, a2, b1, b2, c1, c2);
-	float rSum = a.radius + b.radius;
+	if (m_batched && NarrowPhaseBatch::IsAvailable()) {
+		bool sphereA = (A.type == ColliderType::Sphere), boxA = (A.type == ColliderType::Box);
+		bool sphereB = (B.type == ColliderType::Sphere), boxB = (B.type == ColliderType::Box);
 
-	if (distSq >= rSum * rSum) return false;
+		if (sphereA && sphereB) { buckets.sphereSphere.push_back({ &A, &B }); return; }
+		if ((sphereA && boxB) || (boxA && sphereB)) { buckets.sphereBox.push_back({ &A, &B }); return; }
+		if (boxA && boxB) { buckets.boxBox.push_back({ &A, &B }); return; }
+		if (A.type == ColliderType::Capsule && B.type == ColliderType::Capsule) { buckets.capsuleCapsule.push_back({ &A, &B }); return; }
+	}
 
-	float dist = std::sqrt(distSq);
-	XMVECTOR normal;
+	// SIMDJ[lgݍ킹iJvZƋEA~AbVj͂̏Ŕ
+	Physics::Contact contact;
+	if (!Physics::UsesGJK(A.type, B.type)) {
+		if (TestPair(A, B, contact)) out.push_back(contact);
+		return;
+	}
 
-	if (dist < 1e-4f) {
-		normal = XMVectorSet(0, 1, 0, 0);
-		dist = 0.0f;
+	// GJK ͑O̒P̂n߂iĂg 1, 2 Ŏj
+	Physics::CachedSimplex entry = { ((uint64_t)A.entity << 32) | B.entity, {} };
+	auto it = std::lower_bound(m_simplexCache.begin(), m_simplexCache.end(), entry.key,
+		[](const Physics::CachedSimplex& c, uint64_t key) { return c.key < key; });
+	if (it != m_simplexCache.end() && it->key == entry.key) entry.simplex = it->simplex;
+
+	if (TestPair(A, B, contact, &entry.simplex)) out.push_back(contact);
+	simplices.push_back(entry);
+}
+
+void CollisionSystem::FlushBuckets(Physics::PairBuckets& buckets, std::vector<Physics::Contact>& out)
+{
+	if (buckets.empty()) return;
+
+	NarrowPhaseBatch::SphereSphere(buckets.sphereSphere.data(), buckets.sphereSphere.size(), out);
+	NarrowPhaseBatch::SphereOBB(buckets.sphereBox.data(), buckets.sphereBox.size(), out, buckets.fallback);
+	NarrowPhaseBatch::OBBOBB(buckets.boxBox.data(), buckets.boxBox.size(), out);
+	NarrowPhaseBatch::CapsuleCapsule(buckets.capsuleCapsule.data(), buckets.capsuleCapsule.size(), out);
+
+	// ̒S̒ɂ́i߂ɖj̓XJ[Ŕ肵
+	for (const auto& pair : buckets.fallback) {
+		Physics::Contact contact;
+		if (TestPair(*pair.a, *pair.b, contact)) out.push_back(contact);
 	}
-	else {
-		normal = (c2 - c1) / dist; // A -> B
+	buckets.clear();
+}
+
+void CollisionSystem::UpdateEvents(Registry& registry)
+{
+	m_events.clear();
+
+	auto emit = [this](const std::vector<uint64_t>& keys, Physics::CollisionEventType type) {
+		for (uint64_t key : keys) {
+			m_events.push_back({ type, Physics::PairSet::KeyFirst(key), Physics::PairSet::KeySecond(key) });
+		}
+		};
+
+	// --- 1. gK[iXbhƂ̌ʂ܂Ƃ߂ďɁj ---
+	m_currentKeys.clear();
+	for (const auto& buffer : m_threadTriggers) {
+		m_currentKeys.insert(m_currentKeys.end(), buffer.begin(), buffer.end());
+	}
+	std::sort(m_currentKeys.begin(), m_currentKeys.end());
+	m_currentKeys.erase(std::unique(m_currentKeys.begin(), m_currentKeys.end()), m_currentKeys.end());
+	KeepRestingPairs(registry, m_triggerPairs, m_currentKeys);
+
+	m_triggerPairs.Update(m_currentKeys, m_entered, m_stayed, m_exited);
+	emit(m_entered, Physics::CollisionEventType::TriggerEnter);
+	emit(m_stayed, Physics::CollisionEventType::TriggerStay);
+	emit(m_exited, Physics::CollisionEventType::TriggerExit);
+
+	// --- 2. ڐGiogj ---
+	m_currentKeys.clear();
+	for (const auto& contact : m_contacts) {
+		m_currentKeys.push_back(Physics::PairSet::MakeKey(contact.a, contact.b));
 	}
+	std::sort(m_currentKeys.begin(), m_currentKeys.end());
+	m_currentKeys.erase(std::unique(m_currentKeys.begin(), m_currentKeys.end()), m_currentKeys.end());
+	KeepRestingPairs(registry, m_contactPairs, m_currentKeys);
+
+	m_contactPairs.Update(m_currentKeys, m_entered, m_stayed, m_exited);
+	emit(m_entered, Physics::CollisionEventType::CollisionEnter);
+	emit(m_stayed, Physics::CollisionEventType::CollisionStay);
+	emit(m_exited, Physics::CollisionEventType::CollisionExit);
+}
 
-	XMStoreFloat3(&outContact.normal, normal);
-	outContact.depth = rSum - dist;
+bool CollisionSystem::WasResting(Registry& registry, Entity e) const
+{
+	if (e < m_sleepFlags.size() && m_sleepFlags[e]) return true;
+	if (!registry.has<Collider>(e)) return false;
+	return !registry.has<Rigidbody>(e) || registry.get<Rigidbody>(e).type == BodyType::Static;
+}
+
+void CollisionSystem::KeepRestingPairs(Registry& registry, const Physics::PairSet& previous, std::vector<uint64_t>& keys)
+{
+	if (m_sleepingProxies.empty()) return;
+
+	const size_t count = keys.size();
+	previous.ForEach([&](uint64_t key) {
+		Entity a = Physics::PairSet::KeyFirst(key);
+		Entity b = Physics::PairSet::KeySecond(key);
+		if (WasResting(registry, a) && WasResting(registry, b)) keys.push_back(key);
+		});
+	if (keys.size() == count) return;
+
+	std::sort(keys.begin(), keys.end());
+	keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
+// ÓIȓ蔻̑ΏۂiȂ & eɘAēȂj
+bool CollisionSystem::IsStatic(Registry& registry, Entity e)
+{
+	if (registry.has<Rigidbody>(e) && registry.get<Rigidbody>(e).type != BodyType::Static) return false;
+	if (registry.has<Relationship>(e) && registry.get<Relationship>(e).parent != NullEntity) return false;
 	return true;
 }
 
-// Cylinder vs Cylinder (JvZߎ)
-bool CollisionSystem::CheckCylinderCylinder(const Physics::Cylinder& a, const Physics::Cylinder& b, Physics::Contact& outContact) {
-	Physics::Capsule capA, capB;
-	XMVECTOR axisA = XMLoadFloat3(&a.axis);
-	XMVECTOR centerA = XMLoadFloat3(&a.center);
-	float halfHA = a.height * 0.5f;
-	XMStoreFloat3(&capA.start, centerA - axisA * halfHA);
-	XMStoreFloat3(&capA.end, centerA + axisA * halfHA);
-	capA.radius = a.radius;
+bool CollisionSystem::StaticMoved(Registry& registry)
+{
+	// [hs񂪕ς[giHierarchySystem tĵAÓIBVHɓĂׂ̂
+	bool moved = false;
+	XMFLOAT4X4 world;
+	registry.drain_marked<Transform>([&](Entity e) {
+		if (moved || e >= m_staticSlot.size() || m_staticSlot[e] >= m_staticEntries.size()) return;
+		if (!registry.has<Transform>(e)) return;	// 폜ꂽirevision ς̂ō蒼j
+		const StaticEntry& entry = m_staticEntries[m_staticSlot[e]];
+		if (entry.entity != e) return;
+		XMStoreFloat4x4(&world, registry.get<Transform>(e).worldMatrix);
+		if (std::memcmp(&world, &entry.world, sizeof(XMFLOAT4X4)) != 0) moved = true;
+		});
+	return moved;
+}
 
-	XMVECTOR axisB = XMLoadFloat3(&b.axis);
-	XMVECTOR centerB = XMLoadFloat3(&b.center);
-	float halfHB = b.height * 0.5f;
-	XMStoreFloat3(&capB.start, centerB - axisB * halfHB);
-	XMStoreFloat3(&capB.end, centerB + axisB * halfHB);
-	capB.radius = b.radius;
+bool CollisionSystem::StaticMeshChanged()
+{
+	if (m_staticMeshCount == 0) return false;
 
-	return CheckCapsuleCapsule(capA, capB, outContact);
+	auto& library = Physics::TriangleMeshLibrary::Instance();
+	if (library.GetGeneration() != m_staticMeshGeneration) return true;
+
+	// ǂ߂ĂȂf́AfVo^Eǂݍ݂ꂽǂݒĂ݂iǂ߂ΐオiށj
+	const uint64_t revision = library.GetModelRevision();
+	if (m_staticInvalidMeshes.empty() || revision == m_staticModelRevision) return false;
+	m_staticModelRevision = revision;
+	for (uint32_t i : m_staticInvalidMeshes) library.GetId(m_staticEntries[i].collider.meshKey);
+	return library.GetGeneration() != m_staticMeshGeneration;
 }
 
-// Sphere vs Cylinder (JvZߎ)
-bool CollisionSystem::CheckSphereCylinder(const Physics::Sphere& s, const Physics::Cylinder& c, Physics::Contact& outContact) {
-	Physics::Capsule cap;
-	XMVECTOR axis = XMLoadFloat3(&c.axis);
-	XMVECTOR center = XMLoadFloat3(&c.center);
-	float halfH = c.height * 0.5f;
-	XMStoreFloat3(&cap.start, center - axis * halfH);
-	XMStoreFloat3(&cap.end, center + axis * halfH);
-	cap.radius = c.radius;
+void CollisionSystem::RefreshStatic(Registry& registry)
+{
+	// --- 1. ÓI / ̂ŐU蕪 ---
+	m_moving.clear();
+	m_staticScratch.clear();
+	registry.view<Transform, Collider>([&](Entity e, Transform& t, Collider& c) {
+		if (IsStatic(registry, e)) {
+			StaticEntry entry;
+			entry.entity = e;
+			XMStoreFloat4x4(&entry.world, t.worldMatrix);
+			entry.collider = c;
+			m_staticScratch.push_back(entry);
+		}
+		else {
+			m_moving.push_back(e);
+		}
+		});
+
+	// ̂ Entity ̏ɏii[͍폜̓ւŕς̂ŁAʂsƂɕςȂ悤Ɂj
+	std::sort(m_moving.begin(), m_moving.end());
+
+	// --- 2. OƓȂ蒼ȂîAȂǁj ---
+	std::sort(m_staticScratch.begin(), m_staticScratch.end(),
+		[](const StaticEntry& a, const StaticEntry& b) { return a.entity < b.entity; });
 
-	return CheckSphereCapsule(s, cap, outContact);
+	bool same = (m_staticScratch.size() == m_staticEntries.size());
+	for (size_t i = 0; same && i < m_staticScratch.size(); ++i) {
+		const auto& a = m_staticScratch[i];
+		const auto& b = m_staticEntries[i];
+		same = a.entity == b.entity &&
+			std::memcmp(&a.world, &b.world, sizeof(XMFLOAT4X4)) == 0 &&
+			SameCollider(a.collider, b.collider);
+	}
+	if (same && !StaticMeshChanged()) return;
+
+	// --- 3. vLVBVH蒼 ---
+	m_staticEntries.swap(m_staticScratch);
+	for (const auto& entry : m_staticScratch) {
+		if (entry.entity < m_staticSlot.size()) m_staticSlot[entry.entity] = 0xFFFFFFFFu;
+	}
+	for (size_t i = 0; i < m_staticEntries.size(); ++i) {
+		Entity e = m_staticEntries[i].entity;
+		if (e >= m_staticSlot.size()) m_staticSlot.resize((size_t)e + 1, 0xFFFFFFFFu);
+		m_staticSlot[e] = (uint32_t)i;
+	}
+	m_staticProxies.resize(m_staticEntries.size());
+	std::vector<Physics::AABB> bounds(m_staticEntries.size());
+	m_staticMeshCount = 0;
+	m_staticInvalidMeshes.clear();
+	for (size_t i = 0; i < m_staticEntries.size(); ++i) {
+		Entity e = m_staticEntries[i].entity;
+		auto& proxy = m_staticProxies[i];
+		BuildProxy(e, registry.get<Transform>(e), registry.get<Collider>(e), BodyType::Static, proxy);
+		bounds[i] = Inflate(proxy, RaySkin);
+		if (proxy.type == ColliderType::Mesh) {
+			++m_staticMeshCount;
+			if (proxy.mesh.mesh == Physics::InvalidMeshId) m_staticInvalidMeshes.push_back((uint32_t)i);
+		}
+	}
+	m_staticBVH.Build(bounds);
+	m_staticMeshGeneration = Physics::TriangleMeshLibrary::Instance().GetGeneration();
+	m_staticModelRevision = Physics::TriangleMeshLibrary::Instance().GetModelRevision();
+	++m_staticRebuildCount;
 }
 
 // =================================================================
-// CXV[v
+// v
 // =================================================================
-void CollisionSystem::Update(Registry& registry) {
-	struct CollisionProxy {
-		Entity entity;
-		ColliderType type;
-		bool isTrigger;
-		BodyType bodyType;
-		Physics::Sphere sphere;
-		Physics::OBB obb;
-		Physics::Capsule capsule;
-		Physics::Cylinder cylinder;
-	};
-	std::vector<CollisionProxy> proxies;
 
-	registry.view<Transform, Collider>([&](Entity e, Transform& t, Collider& c) {
-		CollisionProxy proxy;
-		proxy.entity = e;
-		proxy.type = c.type;
-		proxy.isTrigger = c.isTrigger;
-		if (registry.has<Rigidbody>(e)) proxy.bodyType = registry.get<Rigidbody>(e).type;
-		else proxy.bodyType = BodyType::Static;
-
-		XMVECTOR scale, rotQuat, pos;
-		XMMatrixDecompose(&scale, &rotQuat, &pos, t.worldMatrix);
-		XMFLOAT3 gScale; XMStoreFloat3(&gScale, scale);
-		XMMATRIX rotMat = XMMatrixRotationQuaternion(rotQuat);
-
-		XMVECTOR offsetVec = XMLoadFloat3(&c.offset);
-		XMVECTOR centerVec = XMVector3Transform(offsetVec, t.worldMatrix);
-		XMFLOAT3 center; XMStoreFloat3(&center, centerVec);
-
-		if (c.type == ColliderType::Box) {
-			proxy.obb.center = center;
-			proxy.obb.extents = { c.boxSize.x * gScale.x * 0.5f, c.boxSize.y * gScale.y * 0.5f, c.boxSize.z * gScale.z * 0.5f };
-			XMFLOAT4X4 rotM; XMStoreFloat4x4(&rotM, rotMat);
-			proxy.obb.axes[0] = { rotM._11, rotM._12, rotM._13 };
-			proxy.obb.axes[1] = { rotM._21, rotM._22, rotM._23 };
-			proxy.obb.axes[2] = { rotM._31, rotM._32, rotM._33 };
-		}
-		else if (c.type == ColliderType::Sphere) {
-			proxy.sphere.center = center;
-			proxy.sphere.radius = c.sphere.radius * std::max({ gScale.x, gScale.y, gScale.z });
-		}
-		else if (c.type == ColliderType::Capsule) {
-			XMVECTOR axisY = XMVector3TransformNormal(XMVectorSet(0, 1, 0, 0), rotMat);
-			float h = c.capsule.height * gScale.y;
-			float r = c.capsule.radius * std::max(gScale.x, gScale.z);
-			float segLen = std::max(0.0f, h * 0.5f - r);
-			XMStoreFloat3(&proxy.capsule.start, centerVec - axisY * segLen);
-			XMStoreFloat3(&proxy.capsule.end, centerVec + axisY * segLen);
-			proxy.capsule.radius = r;
-		}
-		else if (c.type == ColliderType::Cylinder) {
-			XMStoreFloat3(&proxy.cylinder.center, centerVec);
-			XMVECTOR axisY = XMVector3TransformNormal(XMVectorSet(0, 1, 0, 0), rotMat);
-			XMStoreFloat3(&proxy.cylinder.axis, axisY);
-			proxy.cylinder.height = c.cylinder.height * gScale.y;
-			proxy.cylinder.radius = c.cylinder.radius * std::max(gScale.x, gScale.z);
-		}
-		proxies.push_back(proxy);
-		});
+std::vector<Physics::NarrowPhaseBenchmarkResult> CollisionSystem::RunNarrowPhaseBenchmark(size_t bodyCount, uint32_t maxThreads, int frames)
+{
+	std::vector<Physics::NarrowPhaseBenchmarkResult> results;
+	if (bodyCount == 0 || frames <= 0) return results;
+
+	// --- 1. EEJvZɁAדm߂荞ފԊuŐςݏグ ---
+	Registry registry;
+	const int side = (int)std::ceil(std::cbrt((double)bodyCount));
+	const float spacing = 0.9f;
+	for (size_t i = 0; i < bodyCount; ++i) {
+		int x = (int)(i % side);
+		int z = (int)((i / side) % side);
+		int y = (int)(i / ((size_t)side * side));
+
+		Entity e = registry.create();
+		Transform t({ x * spacing, 0.5f + y * spacing, z * spacing });
+		t.worldPosition = t.position;
+		t.worldMatrix = XMMatrixTranslation(t.position.x, t.position.y, t.position.z);
+		registry.emplace<Transform>(e, t);
+		switch (i % 3) {
+		case 0:	registry.emplace<Collider>(e, Collider::CreateSphere(0.5f)); break;
+		case 1:	registry.emplace<Collider>(e); break;
+		default: registry.emplace<Collider>(e, Collider::CreateCapsule(0.3f, 0.9f)); break;
+		}
+		registry.emplace<Rigidbody>(e, Rigidbody(BodyType::Dynamic));
+	}
 
-	std::vector<Physics::Contact> contacts;
+	// 
+	{
+		Entity e = registry.create();
+		Transform t({ side * spacing * 0.5f, -0.5f, side * spacing * 0.5f }, { 0, 0, 0 }, { side * spacing + 2.0f, 1.0f, side * spacing + 2.0f });
+		t.worldPosition = t.position;
+		t.worldScale = t.scale;
+		t.worldMatrix = XMMatrixScaling(t.scale.x, t.scale.y, t.scale.z) * XMMatrixTranslation(t.position.x, t.position.y, t.position.z);
+		registry.emplace<Transform>(e, t);
+		registry.emplace<Collider>(e);
+	}
 
-	// 蔻 (O(N^2))
-	for (size_t i = 0; i < proxies.size(); ++i) {
-		for (size_t j = i + 1; j < proxies.size(); ++j) {
-			auto& A = proxies[i];
-			auto& B = proxies[j];
+	// --- 2. vLVƌyA1񂾂ii[tF[Yvj ---
+	CollisionSystem system;
+	system.BuildProxies(registry);
+	system.m_broadphase->Update(system.m_proxies, system.m_pairs);
 
-			if (A.bodyType == BodyType::Static && B.bodyType == BodyType::Static) continue;
+	// --- 3. XJ[E1XbhɁASIMDJ[lŃXbh 1, 2, 4, ... ƕςČv ---
+	JobSystem& jobs = JobSystem::Instance();
+	uint32_t originalThreads = jobs.GetThreadCount();
+	std::vector<Physics::Contact> reference;
 
-			Physics::Contact contact;
-			contact.a = A.entity;
-			contact.b = B.entity;
-			bool hit = false;
+	auto measure = [&](uint32_t threads, bool batched) {
+		jobs.SetThreadCount(threads);
+		system.m_batched = batched;
 
-			// Sphere vs ...
-			if (A.type == ColliderType::Sphere && B.type == ColliderType::Sphere)
-				hit = CheckSphereSphere(A.sphere, B.sphere, contact);
-			else if (A.type == ColliderType::Sphere && B.type == ColliderType::Box)
-				hit = CheckSphereOBB(A.sphere, B.obb, contact);
-			else if (A.type == ColliderType::Box && B.type == ColliderType::Sphere) {
-				hit = CheckSphereOBB(B.sphere, A.obb, contact);
-				if (hit) { contact.normal.x *= -1; contact.normal.y *= -1; contact.normal.z *= -1; }
-			}
-			else if (A.type == ColliderType::Sphere && B.type == ColliderType::Capsule)
-				hit = CheckSphereCapsule(A.sphere, B.capsule, contact);
-			else if (A.type == ColliderType::Capsule && B.type == ColliderType::Sphere) {
-				hit = CheckSphereCapsule(B.sphere, A.capsule, contact);
-				if (hit) { contact.normal.x *= -1; contact.normal.y *= -1; contact.normal.z *= -1; }
-			}
-			else if (A.type == ColliderType::Sphere && B.type == ColliderType::Cylinder)
-				hit = CheckSphereCylinder(A.sphere, B.cylinder, contact);
-			else if (A.type == ColliderType::Cylinder && B.type == ColliderType::Sphere) {
-				hit = CheckSphereCylinder(B.sphere, A.cylinder, contact);
-				if (hit) { contact.normal.x *= -1; contact.normal.y *= -1; contact.normal.z *= -1; }
-			}
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int f = 0; f < frames; ++f) {
+			system.RunNarrowPhase();
+		}
+		auto end = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> ms = end - start;
+
+		Physics::NarrowPhaseBenchmarkResult r;
+		r.threads = threads;
+		r.batched = batched && NarrowPhaseBatch::IsAvailable();
+		r.averageMs = ms.count() / frames;
+		r.contacts = system.m_contacts.size();
+
+		// ̌ʂƃrbgPʂňv邩
+		if (reference.empty()) reference = system.m_contacts;
+		r.matchesReference = reference.size() == system.m_contacts.size();
+		for (size_t i = 0; r.matchesReference && i < reference.size(); ++i) {
+			const auto& x = reference[i];
+			const auto& y = system.m_contacts[i];
+			r.matchesReference = x.a == y.a && x.b == y.b && x.depth == y.depth &&
+				x.normal.x == y.normal.x && x.normal.y == y.normal.y && x.normal.z == y.normal.z;
+		}
+		results.push_back(r);
+		};
 
-			// Box vs ...
-			else if (A.type == ColliderType::Box && B.type == ColliderType::Box)
-				hit = CheckOBBOBB(A.obb, B.obb, contact);
-			else if (A.type == ColliderType::Box && B.type == ColliderType::Capsule)
-				hit = CheckOBBCapsule(A.obb, B.capsule, contact);
-			else if (A.type == ColliderType::Capsule && B.type == ColliderType::Box) {
-				hit = CheckOBBCapsule(B.obb, A.capsule, contact);
-				if (hit) { contact.normal.x *= -1; contact.normal.y *= -1; contact.normal.z *= -1; }
-			}
-			else if (A.type == ColliderType::Box && B.type == ColliderType::Cylinder)
-				hit = CheckOBBCylinder(A.obb, B.cylinder, contact);
-			else if (A.type == ColliderType::Cylinder && B.type == ColliderType::Box) {
-				hit = CheckOBBCylinder(B.obb, A.cylinder, contact);
-				if (hit) { contact.normal.x *= -1; contact.normal.y *= -1; contact.normal.z *= -1; }
-			}
+	measure(1, false);
+	if (NarrowPhaseBatch::IsAvailable()) {
+		for (uint32_t threads = 1; threads <= std::max(1u, maxThreads); threads *= 2) {
+			measure(threads, true);
+		}
+	}
 
-			// Capsule vs ...
-			else if (A.type == ColliderType::Capsule && B.type == ColliderType::Capsule)
-				hit = CheckCapsuleCapsule(A.capsule, B.capsule, contact);
-			else if (A.type == ColliderType::Capsule && B.type == ColliderType::Cylinder) {
-				// ~JvZߎĔ
-				Physics::Capsule cylCap;
-				XMVECTOR cAx = XMLoadFloat3(&B.cylinder.axis);
-				XMVECTOR cC = XMLoadFloat3(&B.cylinder.center);
-				float hH = B.cylinder.height * 0.5f;
-				XMStoreFloat3(&cylCap.start, cC - cAx * hH);
-				XMStoreFloat3(&cylCap.end, cC + cAx * hH);
-				cylCap.radius = B.cylinder.radius;
-				hit = CheckCapsuleCapsule(A.capsule, cylCap, contact);
-			}
-			else if (A.type == ColliderType::Cylinder && B.type == ColliderType::Capsule) {
-				Physics::Capsule cylCap;
-				XMVECTOR cAx = XMLoadFloat3(&A.cylinder.axis);
-				XMVECTOR cC = XMLoadFloat3(&A.cylinder.center);
-				float hH = A.cylinder.height * 0.5f;
-				XMStoreFloat3(&cylCap.start, cC - cAx * hH);
-				XMStoreFloat3(&cylCap.end, cC + cAx * hH);
-				cylCap.radius = A.cylinder.radius;
-				hit = CheckCapsuleCapsule(cylCap, B.capsule, contact);
+	jobs.SetThreadCount(originalThreads);
+	return results;
+}
+
+Physics::RaycastBenchmarkResult CollisionSystem::RunRaycastBenchmark(size_t agentCount, int frames)
+{
+	Physics::RaycastBenchmarkResult result;
+	if (agentCount == 0 || frames <= 0) return result;
+
+	// --- 1. iqɕׂƁÅԂ𓮂 ---
+	Registry registry;
+	auto addBody = [&](const XMFLOAT3& pos, const XMFLOAT3& scale, const Collider& collider, bool dynamic) {
+		Entity e = registry.create();
+		Transform t(pos, { 0, 0, 0 }, scale);
+		t.worldPosition = t.position;
+		t.worldScale = t.scale;
+		t.worldMatrix = XMMatrixScaling(scale.x, scale.y, scale.z) * XMMatrixTranslation(pos.x, pos.y, pos.z);
+		registry.emplace<Transform>(e, t);
+		registry.emplace<Collider>(e, collider);
+		if (dynamic) registry.emplace<Rigidbody>(e, Rigidbody(BodyType::Dynamic));
+		};
+
+	const int side = 24;
+	const float spacing = 4.0f;
+	const float half = side * spacing * 0.5f;
+	addBody({ 0.0f, -0.5f, 0.0f }, { side * spacing, 1.0f, side * spacing }, Collider(), false);
+	for (int x = 0; x < side; ++x) {
+		for (int z = 0; z < side; ++z) {
+			XMFLOAT3 pos = { x * spacing - half + 2.0f, 1.5f, z * spacing - half + 2.0f };
+			if ((x + z) % 3 == 0) addBody(pos, { 1.0f, 3.0f, 1.0f }, Collider(), false);
+			else if ((x + z) % 3 == 1) addBody({ pos.x + 1.0f, 0.5f, pos.z - 1.0f }, { 1.0f, 1.0f, 1.0f }, Collider::CreateSphere(0.5f), true);
+		}
+	}
+
+	CollisionSystem system;
+	system.BuildProxies(registry);
+	result.colliders = system.m_staticProxies.size() + system.m_proxies.size();
+
+	// --- 2. ̒[ɕׂG璆̖ڕWւ̌ʂ ---
+	std::vector<Physics::Ray> rays(agentCount);
+	for (size_t i = 0; i < agentCount; ++i) {
+		float angle = XM_2PI * (float)i / (float)agentCount;
+		float radius = half * (0.5f + 0.45f * (float)((i * 7) % 11) / 10.0f);
+		XMFLOAT3 origin = { std::cos(angle) * radius, 1.0f, std::sin(angle) * radius };
+		XMVECTOR toTarget = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f) - XMLoadFloat3(&origin);
+
+		rays[i].origin = origin;
+		XMStoreFloat3(&rays[i].direction, XMVector3Normalize(toTarget));
+		rays[i].maxDistance = XMVectorGetX(XMVector3Length(toTarget));
+	}
+	result.rays = rays.size();
+	result.packetWidth = RayBatch::GetPacketWidth();
+
+	auto time = [&](auto&& func) {
+		auto start = std::chrono::high_resolution_clock::now();
+		for (int f = 0; f < frames; ++f) func();
+		auto end = std::chrono::high_resolution_clock::now();
+		std::chrono::duration<double, std::milli> ms = end - start;
+		return ms.count() / frames;
+		};
+
+	// --- 3. i̐̂ Closest Ɣׂj ---
+	std::vector<Entity> reference(rays.size());
+	std::vector<float> referenceDist(rays.size());
+	result.bruteForceMs = time([&] {
+		for (size_t i = 0; i < rays.size(); ++i) {
+			reference[i] = Raycast(registry, rays[i].origin, rays[i].direction, referenceDist[i]);
+		}
+		});
+
+	// --- 4. ob`iClosest ͋̐OĔׂBAny ͌ʂj ---
+	std::vector<Physics::Ray> unlimited = rays;
+	for (auto& ray : unlimited) ray.maxDistance = FLT_MAX;
+
+	std::vector<Physics::RayHit> hits;
+	result.closestMs = time([&] { system.RaycastBatch(unlimited, RayQuery::Closest, hits); });
+	for (size_t i = 0; result.matchesReference && i < rays.size(); ++i) {
+		// ŕɓ͂ǂԂĂ悢
+		result.matchesReference = hits[i].entity == reference[i] ||
+			(hits[i].entity != NullEntity && reference[i] != NullEntity && std::abs(hits[i].distance - referenceDist[i]) < 1e-4f);
+	}
+
+	result.anyMs = time([&] { system.RaycastBatch(rays, RayQuery::Any, hits); });
+	return result;
+}
+
+Physics::DeterminismCheckResult CollisionSystem::RunDeterminismCheck(size_t bodyCount, uint32_t maxThreads, int frames)
+{
+	Physics::DeterminismCheckResult result;
+	result.bodies = bodyCount;
+	result.frames = frames;
+	if (bodyCount == 0 || frames <= 0) return result;
+
+	Physics::Determinism& determinism = Physics::Determinism::Instance();
+	const bool wasEnabled = determinism.IsEnabled();
+	determinism.SetEnabled(true);
+
+	JobSystem& jobs = JobSystem::Instance();
+	const uint32_t originalThreads = jobs.GetThreadCount();
+	const int side = (int)std::ceil(std::sqrt((double)bodyCount));
+	const float spacing = 1.1f;
+
+	// --- 1. ̏ɁAEEJvZ炵ĐςݏグȂx^ėƂ ---
+	// reversed Ȃ瓯 Entity ɋt̏ԂŃR|[lgtii[Ⴄj
+	auto build = [&](Registry& registry, bool reversed) {
+		std::vector<Entity> entities(bodyCount);
+		for (auto& e : entities) e = registry.create();
+
+		for (size_t n = 0; n < bodyCount; ++n) {
+			size_t i = reversed ? bodyCount - 1 - n : n;
+			int x = (int)(i % side);
+			int z = (int)((i / side) % side);
+			int y = (int)(i / ((size_t)side * side));
+			float jitter = 0.05f * (float)((i * 7) % 5);
+
+			Transform t({ x * spacing + jitter, 1.0f + y * spacing * 1.5f, z * spacing - jitter });
+			t.worldPosition = t.position;
+			t.worldMatrix = XMMatrixTranslation(t.position.x, t.position.y, t.position.z);
+			registry.emplace<Transform>(entities[i], t);
+
+			switch (i % 3) {
+			case 0: registry.emplace<Collider>(entities[i], Collider::CreateSphere(0.5f)); break;
+			case 1: registry.emplace<Collider>(entities[i]); break;
+			default: registry.emplace<Collider>(entities[i], Collider::CreateCapsule(0.3f, 1.0f)); break;
 			}
 
-			// Cylinder vs Cylinder
-			else if (A.type == ColliderType::Cylinder && B.type == ColliderType::Cylinder)
-				hit = CheckCylinderCylinder(A.cylinder, B.cylinder, contact);
+			Rigidbody rb(BodyType::Dynamic);
+			rb.velocity = { 0.5f * (float)((i * 3) % 5) - 1.0f, 0.0f, 0.25f * (float)(i % 4) };
+			registry.emplace<Rigidbody>(entities[i], rb);
+		}
+
+		Entity floor = registry.create();
+		Transform t({ side * spacing * 0.5f, -0.5f, side * spacing * 0.5f }, { 0, 0, 0 }, { side * spacing + 4.0f, 1.0f, side * spacing + 4.0f });
+		t.worldPosition = t.position;
+		t.worldScale = t.scale;
+		t.worldMatrix = XMMatrixScaling(t.scale.x, t.scale.y, t.scale.z) * XMMatrixTranslation(t.position.x, t.position.y, t.position.z);
+		registry.emplace<Transform>(floor, t);
+		registry.emplace<Collider>(floor);
+		};
 
+	// --- 2. 1񕪂̎sit[Ƃ̃`FbNTԂj ---
+	auto run = [&](uint32_t threads, bool reversed) {
+		jobs.SetThreadCount(threads);
 
-			if (hit) {
-				if (A.isTrigger || B.isTrigger) {
-					// Logger::Log("Trigger Hit!");
-				}
-				else {
-					contacts.push_back(contact);
-				}
+		Registry registry;
+		build(registry, reversed);
+		PhysicsSystem physics;
+		CollisionSystem collision;
+
+		std::vector<uint64_t> checksums;
+		checksums.reserve(frames);
+		for (int f = 0; f < frames; ++f) {
+			physics.Step(registry, Physics::Determinism::FixedDeltaTime);
+
+			// eq]ʂȂ̂ŁAHierarchySystem ̑ɈʒusɈڂ
+			registry.view<Transform, Rigidbody>([](Entity, Transform& t, Rigidbody&) {
+				t.worldPosition = t.position;
+				t.worldMatrix = XMMatrixTranslation(t.position.x, t.position.y, t.position.z);
+				});
+
+			collision.Step(registry, Physics::Determinism::FixedDeltaTime);
+			checksums.push_back(collision.GetStateChecksum());
+		}
+		return checksums;
+		};
+
+	// --- 3. 2Ei[ւāEXbh 1 / maxThreads ɂĔׂ ---
+	const std::vector<uint64_t> reference = run(originalThreads, false);
+	const std::pair<uint32_t, bool> variants[] = {
+		{ originalThreads, false }, { originalThreads, true }, { 1u, false }, { std::max(1u, maxThreads), false },
+	};
+	result.runs = 1;
+	for (const auto& variant : variants) {
+		std::vector<uint64_t> checksums = run(variant.first, variant.second);
+		for (int f = 0; f < frames; ++f) {
+			if (checksums[f] == reference[f]) continue;
+			if (result.matches) {
+				result.matches = false;
+				result.firstMismatchFrame = f;
+				result.mismatchRun = result.runs;
 			}
+			break;
 		}
+		++result.runs;
 	}
+	result.finalChecksum = reference.back();
 
-	PhysicsSystem::Solve(registry, contacts);
-}
\ No newline at end of file
+	jobs.SetThreadCount(originalThreads);
+	determinism.SetEnabled(wasEnabled);
+	return result;
+}
+
+std::vector<std::string> CollisionSystem::RunContactCheck()
+{
+	std::vector<std::string> failures;
+	CollisionSystem system;
+
+	auto make = [](Entity e, const Collider& c, const XMFLOAT3& position) {
+		Transform t(position);
+		t.worldPosition = position;
+		t.worldMatrix = XMMatrixTranslation(position.x, position.y, position.z);
+		Physics::CollisionProxy proxy;
+		BuildProxy(e, t, c, BodyType::Dynamic, proxy);
+		return proxy;
+		};
+	// A  B 𔻒肵AB 猩 A ։oi@jƂm߂
+	auto expectAUp = [&](const char* name, const Physics::CollisionProxy& a, const Physics::CollisionProxy& b) {
+		Physics::Contact contact;
+		if (!system.TestPair(a, b, contact) || contact.normal.y >= 0.0f) failures.push_back(name);
+		if (!system.TestPair(b, a, contact) || contact.normal.y <= 0.0f) failures.push_back(std::string(name) + " (flipped)");
+		};
+
+	const Physics::CollisionProxy box = make(1, Collider(), { 0.0f, 0.0f, 0.0f });
+
+	// ̒S̒SƏdȂĂiʂ܂Ȃ͏։oj
+	expectAUp("sphere centred in box", make(2, Collider::CreateSphere(0.25f), { 0.0f, 0.0f, 0.0f }), box);
+	// ̏ʂɏ߂荞񂾋
+	expectAUp("sphere on box", make(2, Collider::CreateSphere(0.25f), { 0.1f, 0.7f, -0.1f }), box);
+	// S̒́Aʂ̋߂ɂ鋅
+	expectAUp("sphere inside box near top", make(2, Collider::CreateSphere(0.25f), { 0.0f, 0.45f, 0.0f }), box);
+
+	return failures;
+}
@@ -24,6 +24,19 @@
 #include "Engine/ECS/ECS.h"
 #include "Game/Components/Components.h"
 #include "Game/Systems/Physics/PhysicsSystem.h"
+#include "Game/Systems/Logic/HierarchySystem.h"
+#include "Game/Systems/Physics/Broadphase.h"
+#include "Game/Systems/Physics/StaticBVH.h"
+#include "Game/Systems/Physics/ContactSolver.h"
+#include "Game/Systems/Physics/PairSet.h"
+#include "Game/Systems/Physics/LayerMatrix.h"
+#include "Game/Systems/Physics/IslandManager.h"
+#include "Game/Systems/Physics/Determinism.h"
+#include "Game/Systems/Physics/GJK.h"
+#include "Game/Systems/Physics/TriangleMesh.h"
+#include <vector>
+#include <string>
+#include <cfloat>
 
 /**
  * @namespace	Physics
@@ -76,35 +89,514 @@ namespace Physics
 		float height;
 		float radius;
 	};
+
+	/**
+	 * @struct	MeshInstance
+	 * @brief	Op`bV̒uiOp`͓f Collider ŋL TriangleMeshj
+	 */
+	struct MeshInstance
+	{
+		uint32_t mesh;			// TriangleMeshLibrary ̔ԍiInvalidMeshId Ȃ牽ƂȂj
+		XMFLOAT3 position;		// fԂ̌_̃[hWioffset ݁j
+		XMFLOAT4 rotation;		// [h]iNH[^jIj
+		XMFLOAT3 scale;			// [hXP[
+	};
+
+	/**
+	 * @struct	CollisionProxy
+	 * @brief	[hԂ̓蔻f[^i蔻育ƂɎAς蒼j
+	 */
+	struct CollisionProxy
+	{
+		XMFLOAT3 aabbMin;	// u[htF[Ypi`ƈꏏɌvZς݁j
+		XMFLOAT3 aabbMax;
+		Entity entity;
+		uint32_t mask;		// 鑊̃C[iCollider::maskj
+		ColliderType type;	// p̂̂ǂꂪL
+		BodyType bodyType;
+		CollisionLayer layer;
+		bool isTrigger;
+		bool isSleeping;	// Ă DynamiciȂj
+
+		// p̂Ńߖitype ̌`󂾂Lj
+		union
+		{
+			Sphere sphere;
+			OBB obb;
+			Capsule capsule;
+			Cylinder cylinder;
+			MeshInstance mesh;
+		};
+	};
+
+	/**
+	 * @brief	C[ƃ}XNŔ肵Ă悢gii[tF[Y̑OɐU藎Ƃj
+	 */
+	inline bool ShouldCollide(const CollisionProxy& a, const CollisionProxy& b, const LayerMatrix& matrix)
+	{
+		return (a.mask & LayerBit(b.layer)) != 0 &&
+			(b.mask & LayerBit(a.layer)) != 0 &&
+			matrix.CanCollide(a.layer, b.layer);
+	}
+
+	/**
+	 * @brief	Ȃ́iStaticEĂ鍄́jBȂ画肵Ȃ
+	 */
+	inline bool IsResting(const CollisionProxy& p)
+	{
+		return p.bodyType == BodyType::Static || p.isSleeping;
+	}
+
+	/**
+	 * @struct	QueryFilter
+	 * @brief	dȂE`LXg̖₢킹őΏۂɂ
+	 */
+	struct QueryFilter
+	{
+		uint32_t layerMask = 0xFFFFFFFFu;	// Ă郌C[iLayerBit ̑gݍ킹j
+		bool hitTriggers = true;			// gK[܂߂邩
+		Entity ignore = NullEntity;			// ́i₢킹{lȂǁj
+	};
+
+	inline bool PassesFilter(const CollisionProxy& p, const QueryFilter& filter)
+	{
+		return p.entity != filter.ignore &&
+			(filter.hitTriggers || !p.isTrigger) &&
+			(filter.layerMask & LayerBit(p.layer)) != 0;
+	}
+
+	/**
+	 * @struct	ShapeHit
+	 * @brief	`LXgōŏɐGꂽ
+	 */
+	struct ShapeHit
+	{
+		Entity entity = NullEntity;
+		float distance = 0.0f;			// G܂łɓ
+		XMFLOAT3 normal = { 0, 0, 0 };	// Gꂽʂ̌i肩LXg`ցj
+	};
+
+	// ₢킹p̌`ivLVƂč̂ Check* ֐ł̂܂ܔłj
+	CollisionProxy MakeSphereShape(const XMFLOAT3& center, float radius);
+	CollisionProxy MakeBoxShape(const XMFLOAT3& center, const XMFLOAT3& halfExtents, const XMFLOAT4& rotation = { 0, 0, 0, 1 });
+	CollisionProxy MakeCapsuleShape(const XMFLOAT3& start, const XMFLOAT3& end, float radius);
+
+	/**
+	 * @struct	ShapePair
+	 * @brief	i[tF[Yɂ2̃vLVia  Contact::a ɂȂj
+	 */
+	struct ShapePair
+	{
+		const CollisionProxy* a;
+		const CollisionProxy* b;
+	};
+
+	/**
+	 * @struct	PairBuckets
+	 * @brief	`̑gݍ킹ƂɕyAi܂Ƃ߂SIMDŔ肷j
+	 */
+	struct PairBuckets
+	{
+		std::vector<ShapePair> sphereSphere;
+		std::vector<ShapePair> sphereBox;	//  - iԂ͂ǂł悢j
+		std::vector<ShapePair> boxBox;
+		std::vector<ShapePair> capsuleCapsule;
+		std::vector<ShapePair> fallback;	// ob`Ō߂Ȃ́iXJ[Ŕ肵j
+
+		bool empty() const { return sphereSphere.empty() && sphereBox.empty() && boxBox.empty() && capsuleCapsule.empty(); }
+		void clear() { sphereSphere.clear(); sphereBox.clear(); boxBox.clear(); capsuleCapsule.clear(); fallback.clear(); }
+	};
+
+	/**
+	 * @enum	CollisionEventType
+	 * @brief	dȂEڐG̊Jn / p / I
+	 */
+	enum class CollisionEventType
+	{
+		TriggerEnter,
+		TriggerStay,
+		TriggerExit,
+		CollisionEnter,
+		CollisionStay,
+		CollisionExit,
+	};
+
+	/**
+	 * @struct	CollisionEvent
+	 * @brief	1t[̃Cxgia < bBExit ̎͊ɍ폜Ă邱Ƃj
+	 */
+	struct CollisionEvent
+	{
+		CollisionEventType type;
+		Entity a;
+		Entity b;
+	};
+
+	/**
+	 * @struct	Ray
+	 * @brief	܂Ƃ߂Ė₢킹郌C1{
+	 */
+	struct Ray
+	{
+		XMFLOAT3 origin;
+		XMFLOAT3 direction;					// Kς
+		float maxDistance = FLT_MAX;
+		uint32_t layerMask = 0xFFFFFFFFu;	// Ă郌C[iLayerBit ̑gݍ킹j
+		bool hitTriggers = true;			// gK[ɂĂ邩
+	};
+
+	/**
+	 * @enum	RayQuery
+	 * @brief	CƂɕԂ
+	 */
+	enum class RayQuery
+	{
+		Closest,	// ԋ߂́iC1{ɂ1j
+		Any,		// ǂꂩ1iʂȂǁB_őł؂j
+		All,		// S
+	};
+
+	/**
+	 * @struct	RayHit
+	 * @brief	C̓iClosest / Any œȂ entity  NullEntityAdistance  maxDistancej
+	 */
+	struct RayHit
+	{
+		uint32_t ray;		// rays ̔ԍ
+		Entity entity;
+		float distance;
+	};
+
+	/**
+	 * @struct	RaycastBenchmarkResult
+	 * @brief	ƃob`̃CLXǧv
+	 */
+	struct RaycastBenchmarkResult
+	{
+		size_t colliders = 0;
+		size_t rays = 0;
+		double bruteForceMs = 0.0;			// Raycast 1{
+		double closestMs = 0.0;				// RaycastBatchiClosestj
+		double anyMs = 0.0;					// RaycastBatchiAnyj
+		uint32_t packetWidth = 4;
+		bool matchesReference = true;		// Closest ̌ʂƈv
+	};
+
+	/**
+	 * @struct	StepTimings
+	 * @brief	CollisionSystem 1 Step ̒iKƂ̎ [ms]
+	 */
+	struct StepTimings
+	{
+		double proxyMs = 0.0;				// vLV쐬EA
+		double broadphaseMs = 0.0;
+		double narrowPhaseMs = 0.0;
+		double solveMs = 0.0;				// NEڐG̉
+		double otherMs = 0.0;				// ECxgE`FbNT
+	};
+
+	/**
+	 * @struct	NarrowPhaseBenchmarkResult
+	 * @brief	XbhƂ̃i[tF[Y̌v
+	 */
+	struct NarrowPhaseBenchmarkResult
+	{
+		uint32_t threads = 1;
+		double averageMs = 0.0;				// 1t[̕ώ
+		bool batched = false;				// `󂲂ƂSIMDJ[lg
+		size_t contacts = 0;
+		bool matchesReference = true;		// XJ[E1XbȟʂƊSɈv
+	};
 }
 
 class CollisionSystem
 	: public ISystem
 {
 public:
-	CollisionSystem() { m_systemName = "Collision System"; }
+	CollisionSystem()
+		: m_broadphase(Physics::CreateBroadphase(Physics::BroadphaseType::Grid))
+	{
+		m_systemName = "Collision System";
+	}
 
+	/**
+	 * @brief	1t[̔Ɖ
+	 * @details	_[hł Determinism::ConsumeSteps ̉񐔂A
+	 *			ϕiPhysicsSystem::Stepj-> svZiHierarchySystemj-> Step  FixedDeltaTime ŌJԂ܂i0 jB
+	 */
 	void Update(Registry& registry) override;
 
+	// dt bԂ̔Ɖi_̊mFȂǂ Time ʂɐi߂鎞gj
+	void Step(Registry& registry, float dt);
+
+	// u[htF[Y̐؂ւivErpj
+	void SetBroadphase(Physics::BroadphaseType type)
+	{
+		if (m_broadphase->GetType() != type) m_broadphase = Physics::CreateBroadphase(type);
+	}
+	Physics::BroadphaseType GetBroadphaseType() const { return m_broadphase->GetType(); }
+
+	// O Update ̒iKƂ̎ԂƁAڐG̐ivpj
+	const Physics::StepTimings& GetTimings() const { return m_timings; }
+	size_t GetContactCount() const { return m_contacts.size(); }
+
+	// O Update  GJK / EPA Ŕ肵g̐ƁA1g GJK ̕ϔ񐔁imFpj
+	size_t GetGJKPairCount() const { return m_simplexCache.size(); }
+	float GetAverageGJKIterations() const { return m_gjkAverageIterations; }
+
+	// O Update ŘAɂ߂̂̐imFpj
+	size_t GetContinuousHitCount() const { return m_continuousHits; }
+
+	// O Update ŃvLV蒼̂̐i[hs Collider ς́BmFpj
+	size_t GetProxyRebuildCount() const { return m_proxyRebuilds; }
+	size_t GetMovingCount() const { return m_proxies.size(); }
+
+	// ÓIBVHɓĂ铖蔻̐ƁA蒼񐔁imFpj
+	size_t GetStaticCount() const { return m_staticProxies.size(); }
+	size_t GetStaticRebuildCount() const { return m_staticRebuildCount; }
+
+	/**
+	 * @brief	t[̃gK[EڐGCxgiނƂ Entity ̑g̏j
+	 * @details	CollisionSystem ɓo^VXeǂ݂܂B Update ō蒼܂B
+	 *			_[h1t[ɕXebvi߂́AXebv̏ɂȂ܂ii߂Ȃt[͋jB
+	 */
+	const std::vector<Physics::CollisionEvent>& GetEvents() const { return m_events; }
+
+	// _[hŒO Update ̌ɎԂ̃`FbNTi̊Ԃ͍XVȂj
+	uint64_t GetStateChecksum() const { return m_stateChecksum; }
+
+	// ڐG̉i񐔁EEH[X^[g̐ݒpj
+	Physics::ContactSolver& GetSolver() { return m_solver; }
+
+	// ƖiL / EĂ鐔̊mFpj
+	Physics::IslandManager& GetIslands() { return m_islands; }
+
+	// ̃CLXgiCollisionSystem Erpj
 	static Entity Raycast(Registry& registry, const XMFLOAT3& rayOrigin, const XMFLOAT3& rayDir, float& outDist);
 
+	/**
+	 * @brief	̃C܂Ƃ߂Ė₢킹
+	 * @details	ÓIBVHƁÂBVHiUpdate ̍ŏ̖₢킹ōjA
+	 *			C 4{ / 8{̃pPbgɂ܂Ƃ߂ĒH܂Bʒu͒O Update ōvLV̂̂łB
+	 * @param	outHits		Closest / Any ̓CƓ1AAll ̓C̔ԍȄ
+	 */
+	void RaycastBatch(const std::vector<Physics::Ray>& rays, Physics::RayQuery query, std::vector<Physics::RayHit>& outHits);
+
+	// 1{ ClosestiGfB^̃NbNIpj
+	Entity RaycastClosest(const XMFLOAT3& rayOrigin, const XMFLOAT3& rayDir, float& outDist);
+
+	/**
+	 * @brief	shape ƏdȂ̂񋓁iq[vmۂȂj
+	 * @details	u[htF[YiÓIBVHÊBVHjōiAi[tF[YƓ֐Ŋm߂܂B
+	 *			ʒu͒O Update ōvLV̂̂łB
+	 * @param	shape	MakeSphereShape Ȃǂō`
+	 * @param	func	void(Entity)
+	 */
+	template<typename Func>
+	void Overlap(const Physics::CollisionProxy& shape, const Physics::QueryFilter& filter, Func func)
+	{
+		UpdateMovingBVH();
+
+		const Physics::AABB bounds = { shape.aabbMin, shape.aabbMax };
+		auto test = [&](const Physics::CollisionProxy& target) {
+			if (!Physics::PassesFilter(target, filter)) return;
+			Physics::Contact contact;
+			if (TestPair(shape, target, contact)) func(target.entity);
+			};
+		m_staticBVH.Query(bounds, [&](uint32_t item) { test(m_staticProxies[item]); });
+		m_movingBVH.Query(bounds, [&](uint32_t item) { test(m_proxies[item]); });
+	}
+
+	// results ɍő capacity ݁AdȂĂ鐔Ԃicapacity 葽ΏĂȂj
+	size_t OverlapSphere(const XMFLOAT3& center, float radius, Entity* results, size_t capacity, const Physics::QueryFilter& filter = {});
+	size_t OverlapBox(const XMFLOAT3& center, const XMFLOAT3& halfExtents, const XMFLOAT4& rotation, Entity* results, size_t capacity, const Physics::QueryFilter& filter = {});
+	size_t OverlapCapsule(const XMFLOAT3& start, const XMFLOAT3& end, float radius, Entity* results, size_t capacity, const Physics::QueryFilter& filter = {});
+
+	/**
+	 * @brief	shape  direction  maxDistance ܂œɁAŏɐǴiq[vmۂȂj
+	 * @details	n߂dȂĂ̂ distance 0 ŕԂ܂B͎~܂Ă̂ƂĒׂ܂B
+	 * @param	direction	Kς݂̌
+	 * @return	Ĝ true
+	 */
+	bool ShapeCast(const Physics::CollisionProxy& shape, const XMFLOAT3& direction, float maxDistance,
+		Physics::ShapeHit& outHit, const Physics::QueryFilter& filter = {});
+
+	// agentCount ̂ڕWւ̃CAׂő / ob`Ōv
+	static Physics::RaycastBenchmarkResult RunRaycastBenchmark(size_t agentCount, int frames);
+
+	// bodyCount ςݏグRŁAXJ[łƁASIMDJ[lŃXbh 1, 2, 4, ... maxThreads ̃i[tF[YԂv
+	static std::vector<Physics::NarrowPhaseBenchmarkResult> RunNarrowPhaseBenchmark(size_t bodyCount, uint32_t maxThreads, int frames);
+
+	/**
+	 * @brief	bodyCount 𗎂ƂĐςݏグʂ frames t[i߁At[Ƃ̃`FbNTׂ
+	 * @details	2Ei[ւ1EXbh 1  maxThreads 1񂸂s܂B
+	 *			dt  Determinism::FixedDeltaTime ɌŒ肵܂B
+	 */
+	static Physics::DeterminismCheckResult RunDeterminismCheck(size_t bodyCount, uint32_t maxThreads, int frames);
+
+	/**
+	 * @brief	@̌iA -> BAA  -normal ։oj₷g𔻒肵Ċm߂
+	 * @return	҂ƈg̖OiSĂ΋j
+	 */
+	static std::vector<std::string> RunContactCheck();
+
 private:
+	/**
+	 * @struct	StaticEntry
+	 * @brief	ÓIBVH̏ԁiω̌opj
+	 */
+	struct StaticEntry
+	{
+		Entity entity;
+		XMFLOAT4X4 world;
+		Collider collider;
+	};
+
+	// BVHɓAABB̗]iCʂ߂鎞pj
+	static constexpr float RaySkin = 1e-4f;
+
+	/**
+	 * @struct	ProxySource
+	 * @brief	̂̃vLV̓́iȂ蒼Ȃj
+	 */
+	struct ProxySource
+	{
+		XMFLOAT4X4 world;
+		Collider collider;
+		uint64_t meshGeneration = 0;	// MeshCollider ̎A TriangleMeshLibrary ̐
+		uint64_t modelRevision = 0;		// V TriangleMeshLibrary::GetModelRevisionifǂ߂ĂȂ̓ǂݒpj
+		bool valid = false;
+	};
+
+	// Rigidbody i܂ StaticjŁAeȂ̂͐ÓIBVHɓ
+	bool IsStatic(Registry& registry, Entity e);
+
+	// ̂̈ꗗ蒼AÓIȓ蔻肪ςĂBVH蒼
+	void RefreshStatic(Registry& registry);
+
+	// patch Ă΂ɓꂽÓIȓ蔻肪邩
+	// HierarchySystem ti[hs񂪕ςj[gAÓIBVH̍sƔׂ
+	bool StaticMoved(Registry& registry);
+
+	// ÓI MeshCollider ̎Op`o^ꂽEǂ߂ĂȂfǂ߂悤ɂȂ
+	bool StaticMeshChanged();
+
+	// CLXgEdȂ̖₢킹pɁÂBVH蒼iUpdate ̍ŏ1񂾂j
+	void UpdateMovingBVH();
+
+	// ÓILbVmFẪvLVim_proxiesĵς̂蒼
+	void BuildProxies(Registry& registry);
+
+	// ́EAw肵̂AÓIȓ蔻ɍŏɐGꂽʒu܂Ŗ߂
+	// ͐ÓIȓ蔻肾B̓miDynamic / Kinematicj͑|Ȃ̂ŁA̓m͂蔲邱Ƃ
+	void ApplyContinuous(Registry& registry, float dt);
+
+	/**
+	 * @brief	start  disp Ԃ target ƍŏɏdȂ銄
+	 * @param	skin	Gꂽʒu炳ɐi߂鋗
+	 * @return	0 ` limitiGꂽʒu skin i߂ʒujBlimit ܂łɏdȂȂ 1
+	 */
+	float SweepProxy(const Physics::CollisionProxy& start, const XMFLOAT3& disp, const Physics::CollisionProxy& target, float limit, float skin);
+
+	// m_pairs ƐÓIBVH m_contacts iJobSystem ŕɎsj
+	void RunNarrowPhase();
+
+	// yA`̑gݍ킹ƂɐU蕪iSIMDJ[ĺEgK[͂̏Ŕj
+	// GJK Ŕ肵ǵA̒P̂ simplices ɑ
+	void DispatchPair(const Physics::CollisionProxy& A, const Physics::CollisionProxy& B,
+		Physics::PairBuckets& buckets, std::vector<Physics::Contact>& out, std::vector<uint64_t>& triggers,
+		std::vector<Physics::CachedSimplex>& simplices);
+
+	// U蕪yA܂Ƃ߂Ĕ肵ċɂ
+	void FlushBuckets(Physics::PairBuckets& buckets, std::vector<Physics::Contact>& out);
+
+	// gK[̏dȂEڐGOt[Ɣׂ m_events 
+	void UpdateEvents(Registry& registry);
+
+	// Ȃ́iStaticEt[Ắj
+	bool WasResting(Registry& registry, Entity e) const;
+
+	// Ȃg̑Ot[̏ԂAt[̑gɑiĂԂ Stay j
+	void KeepRestingPairs(Registry& registry, const Physics::PairSet& previous, std::vector<uint64_t>& keys);
+
+	// `̑gݍ킹ɉ֐Ăԁig GJK / EPABcache ͂̑g̑O̒Ṕj
+	bool TestPair(const Physics::CollisionProxy& A, const Physics::CollisionProxy& B, Physics::Contact& outContact,
+		Physics::SimplexCache* cache = nullptr);
+
 	// --- ֐Qi]Ήj ---
 	//  vs ...
 	bool CheckSphereSphere(const Physics::Sphere& a, const Physics::Sphere& b, Physics::Contact& outContact);
 	bool CheckSphereOBB(const Physics::Sphere& s, const Physics::OBB& b, Physics::Contact& outContact);
 	bool CheckSphereCapsule(const Physics::Sphere& s, const Physics::Capsule& c, Physics::Contact& outContact);
-	bool CheckSphereCylinder(const Physics::Sphere& s, const Physics::Cylinder& c, Physics::Contact& outContact);
 
 	// OOBijvs ...
 	bool CheckOBBOBB(const Physics::OBB& a, const Physics::OBB& b, Physics::Contact& outContact);
-	bool CheckOBBCapsule(const Physics::OBB& box, const Physics::Capsule& cap, Physics::Contact& outContact);
-	bool CheckOBBCylinder(const Physics::OBB& box, const Physics::Cylinder& cyl, Physics::Contact& outContact);
 
 	// Capsule vs ...
 	bool CheckCapsuleCapsule(const Physics::Capsule& a, const Physics::Capsule& b, Physics::Contact& outContact);
-	bool CheckCylinderCylinder(const Physics::Cylinder& a, const Physics::Cylinder& b, Physics::Contact& outContact);
 
+	// Mesh vs ...idȂOp`Ƃɔ肵A1̐ڐGɂ܂Ƃ߂B@ mesh -> shapej
+	bool CheckMesh(const Physics::MeshInstance& mesh, const Physics::CollisionProxy& shape, Physics::Contact& outContact);
+
+	// t[̊mۂ邽ߎg
+	std::unique_ptr<Physics::IBroadphase> m_broadphase;
+	std::vector<Physics::CollisionProxy> m_proxies;
+	std::vector<ProxySource> m_proxySources;	// m_proxies Ɠ
+	std::vector<uint32_t> m_proxySlot;			// Entity -> m_proxies ̈ʒuî̈ꗗ蒼̈ppj
+	std::vector<Physics::CollisionProxy> m_proxyScratch;
+	std::vector<ProxySource> m_sourceScratch;
+	size_t m_proxyRebuilds = 0;
+	std::vector<uint8_t> m_sleepFlags;			// Entity -> t[Ă
+	std::vector<Entity> m_sleepingProxies;		// m_sleepFlags 𗧂Ă Entityĩt[Ŗ߂j
+	std::vector<Physics::BroadphasePair> m_pairs;
+	std::vector<Physics::Contact> m_contacts;
+	std::vector<std::vector<Physics::Contact>> m_threadContacts;	// XbhƂ̔茋
+	std::vector<Physics::PairBuckets> m_threadBuckets;				// XbhƂ̐U蕪
+	std::vector<std::vector<uint64_t>> m_threadTriggers;			// XbhƂ̃gK[̏dȂiPairSet ̃L[j
+	std::vector<std::vector<Physics::CachedSimplex>> m_threadSimplices;	// XbhƂ̍̒P
+	std::vector<Physics::CachedSimplex> m_simplexCache;				// O̒Ṕikey ̏Bi[tF[Y͓ǂނj
+	float m_gjkAverageIterations = 0.0f;
+	bool m_batched = true;	// false ȂSyA TestPair 1肷irpj
+	size_t m_continuousHits = 0;
+	uint64_t m_stateChecksum = 0;
+	Physics::StepTimings m_timings;
+	std::vector<Entity> m_checksumScratch;
+
+	Physics::ContactSolver m_solver;
+	Physics::IslandManager m_islands;
+
+	// CxgiOt[̑gƂ̍j
+	Physics::PairSet m_triggerPairs;
+	Physics::PairSet m_contactPairs;
+	std::vector<uint64_t> m_currentKeys;
+	std::vector<uint64_t> m_entered, m_stayed, m_exited;
+	std::vector<Physics::CollisionEvent> m_events;
+	std::vector<Physics::CollisionEvent> m_frameEvents;	// _[h1t[̑SXebvW߂
+
+	// _[ȟŒXebvpiPhysicsSystem::Update / HierarchySystem::Update ̑1XebvƂɌĂԁj
+	PhysicsSystem m_fixedPhysics;
+	HierarchySystem m_fixedHierarchy;
+
+	// ÓIȓ蔻iTransform / Collider / Rigidbody / Relationship ̃v[ςmFj
+	uint64_t m_revisions[4] = {};
+	std::vector<Entity> m_moving;					// t[vLV
+	std::vector<StaticEntry> m_staticEntries;		// Entity 
+	std::vector<StaticEntry> m_staticScratch;
+	std::vector<uint32_t> m_staticSlot;			// Entity ID -> m_staticEntries ̔ԍ
+	std::vector<Physics::CollisionProxy> m_staticProxies;
+	Physics::StaticBVH m_staticBVH;
+	size_t m_staticRebuildCount = 0;
+	uint64_t m_staticMeshGeneration = 0;		// ÓIBVH TriangleMeshLibrary ̐
+	uint64_t m_staticModelRevision = 0;			// V TriangleMeshLibrary::GetModelRevision
+	size_t m_staticMeshCount = 0;				// ÓI MeshCollider ̐
+	std::vector<uint32_t> m_staticInvalidMeshes;	// fǂ߂ĂȂÓI MeshColliderim_staticEntries ̔ԍj
+
+	// CLXgEdȂ̖₢킹p̓̂BVHim_proxies ̔ԍBUpdate ŌÂȂj
+	Physics::StaticBVH m_movingBVH;
+	std::vector<Physics::AABB> m_movingBounds;
+	bool m_movingBVHDirty = true;
+	std::vector<Physics::Ray> m_singleRay;
+	std::vector<Physics::RayHit> m_singleHit;
 };
 
 #endif // !___COLLISION_SYSTEM_H___
\ No newline at end of file
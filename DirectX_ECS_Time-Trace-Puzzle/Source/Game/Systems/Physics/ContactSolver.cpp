@@ -0,0 +1,248 @@
+/*****************************************************************//**
+ * @file	ContactSolver.cpp
+ * @brief	ڐG̉iCpX@ + EH[X^[gj
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/ContactSolver.h"
+#include "Engine/Core/JobSystem.h"
+#include <algorithm>
+
+using namespace DirectX;
+
+namespace Physics
+{
+	namespace
+	{
+		constexpr uint32_t InvalidId = 0xFFFFFFFFu;
+
+		// ʒu␳F̐[܂ł̂߂荞݂͋iڐGۂėhhj
+		constexpr float PenetrationSlop = 0.005f;
+		// ʒu␳F1t[Ŗ߂߂荞݂̊
+		constexpr float PositionCorrection = 0.8f;
+
+		// 1̎d̑傫iȉ̐F͂̏ŉj
+		constexpr uint32_t ColorBatch = 128;
+		constexpr uint32_t BodyBatch = 256;
+
+		uint64_t MakeKey(Entity a, Entity b)
+		{
+			return ((uint64_t)a << 32) | (uint64_t)b;
+		}
+	}
+
+	uint32_t ContactSolver::GetBodyId(Registry& registry, Entity entity)
+	{
+		if (entity >= m_bodyIds.size()) m_bodyIds.resize((size_t)entity + 1, InvalidId);
+		if (m_bodyIds[entity] != InvalidId) return m_bodyIds[entity];
+
+		uint32_t id = (uint32_t)m_entities.size();
+		m_bodyIds[entity] = id;
+
+		// Rigidbody AStatic / KinematicEĂ͎̂ʖiKinematic ̑x͑ɓ`j
+		float invMass = 0.0f;
+		XMFLOAT3 velocity = { 0.0f, 0.0f, 0.0f };
+		Rigidbody* rb = nullptr;
+		Transform* t = registry.has<Transform>(entity) ? &registry.get<Transform>(entity) : nullptr;
+		if (registry.has<Rigidbody>(entity)) {
+			Rigidbody& body = registry.get<Rigidbody>(entity);
+			if (body.type != BodyType::Static) velocity = body.velocity;
+			if (body.type == BodyType::Dynamic && !body.isSleeping && body.mass > 0.0f && t) {
+				invMass = 1.0f / body.mass;
+				rb = &body;
+			}
+		}
+
+		m_entities.push_back(entity);
+		m_invMass.push_back(invMass);
+		m_velocities.push_back(velocity);
+		m_positionDeltas.push_back({ 0.0f, 0.0f, 0.0f });
+		m_rigidbodies.push_back(rb);
+		m_transforms.push_back(t);
+		return id;
+	}
+
+	void ContactSolver::ColorConstraints()
+	{
+		// --- 1. S̏ɁA[̓̂܂gĂȂԏFt ---
+		// Ȃ́it 0j͏Ȃ̂ŁAFƋLĂ悢
+		m_bodyColors.assign(m_entities.size(), 0);
+		m_constraintColors.resize(m_constraints.size());
+		m_colorOffsets.assign(MaxColors + 2, 0);
+		m_colorCount = 0;
+
+		for (size_t i = 0; i < m_constraints.size(); ++i) {
+			const Constraint& c = m_constraints[i];
+			bool dynamicA = m_invMass[c.bodyA] > 0.0f, dynamicB = m_invMass[c.bodyB] > 0.0f;
+			uint64_t used = (dynamicA ? m_bodyColors[c.bodyA] : 0) | (dynamicB ? m_bodyColors[c.bodyB] : 0);
+
+			uint32_t color = 0;
+			while (color < MaxColors && (used >> color) & 1) ++color;
+			m_constraintColors[i] = (uint8_t)color;
+			++m_colorOffsets[color + 1];
+			if (color == MaxColors) continue;
+
+			uint64_t bit = (uint64_t)1 << color;
+			if (dynamicA) m_bodyColors[c.bodyA] |= bit;
+			if (dynamicB) m_bodyColors[c.bodyB] |= bit;
+			m_colorCount = std::max(m_colorCount, color + 1);
+		}
+
+		// --- 2. FƂ͈̔͂߁AF͍̒S̏̂܂ܕׂiグ\[gj ---
+		for (uint32_t color = 0; color <= MaxColors; ++color) m_colorOffsets[color + 1] += m_colorOffsets[color];
+		m_colorOrder.resize(m_constraints.size());
+		m_colorCursor.assign(m_colorOffsets.begin(), m_colorOffsets.end() - 1);
+		for (uint32_t i = 0; i < (uint32_t)m_constraints.size(); ++i) {
+			m_colorOrder[m_colorCursor[m_constraintColors[i]]++] = i;
+		}
+	}
+
+	void ContactSolver::SolveVelocity(Constraint& c)
+	{
+		// W 0F߂Âxł
+		XMVECTOR n = XMLoadFloat3(&c.normal);
+		XMVECTOR velA = XMLoadFloat3(&m_velocities[c.bodyA]);
+		XMVECTOR velB = XMLoadFloat3(&m_velocities[c.bodyB]);
+		float vn = XMVectorGetX(XMVector3Dot(velB - velA, n));
+
+		// ݐϒli񂹁jɂȂȂ悤ɐA𓖂Ă
+		float lambda = -vn * c.normalMass;
+		float old = c.impulse;
+		c.impulse = std::max(old + lambda, 0.0f);
+		lambda = c.impulse - old;
+		if (lambda == 0.0f) return;
+
+		// Ȃ̂͏Ȃiʂ̐FEʃXbhƋLĂj
+		XMVECTOR P = n * lambda;
+		if (m_invMass[c.bodyA] > 0.0f) XMStoreFloat3(&m_velocities[c.bodyA], velA - P * m_invMass[c.bodyA]);
+		if (m_invMass[c.bodyB] > 0.0f) XMStoreFloat3(&m_velocities[c.bodyB], velB + P * m_invMass[c.bodyB]);
+	}
+
+	void ContactSolver::SolvePosition(const Constraint& c)
+	{
+		// ߂荞݂tʂ̔ŕĖ߂i߂Ȃ甽j
+		XMVECTOR n = XMLoadFloat3(&c.normal);
+		XMVECTOR deltaA = XMLoadFloat3(&m_positionDeltas[c.bodyA]);
+		XMVECTOR deltaB = XMLoadFloat3(&m_positionDeltas[c.bodyB]);
+		float depth = c.depth - XMVectorGetX(XMVector3Dot(deltaB - deltaA, n));
+
+		float correction = std::max(depth - PenetrationSlop, 0.0f) * PositionCorrection * c.normalMass;
+		if (correction <= 0.0f) return;
+
+		XMVECTOR P = n * correction;
+		if (m_invMass[c.bodyA] > 0.0f) XMStoreFloat3(&m_positionDeltas[c.bodyA], deltaA - P * m_invMass[c.bodyA]);
+		if (m_invMass[c.bodyB] > 0.0f) XMStoreFloat3(&m_positionDeltas[c.bodyB], deltaB + P * m_invMass[c.bodyB]);
+	}
+
+	void ContactSolver::Solve(Registry& registry, const std::vector<Contact>& contacts)
+	{
+		// --- 1. ̂W߂čSiOt[̗ݐσCpX (a, b) œ˂킹j ---
+		for (Entity e : m_entities) m_bodyIds[e] = InvalidId;
+		m_entities.clear();
+		m_invMass.clear();
+		m_velocities.clear();
+		m_positionDeltas.clear();
+		m_rigidbodies.clear();
+		m_transforms.clear();
+		m_constraints.clear();
+
+		size_t cursor = 0;
+		for (const auto& contact : contacts) {
+			uint32_t a = GetBodyId(registry, contact.a);
+			uint32_t b = GetBodyId(registry, contact.b);
+
+			// ȂȂ牽Ȃ
+			float invMassSum = m_invMass[a] + m_invMass[b];
+			if (invMassSum <= 0.0f) continue;
+
+			Constraint c;
+			c.bodyA = a;
+			c.bodyB = b;
+			c.normal = contact.normal;
+			c.depth = contact.depth;
+			c.normalMass = 1.0f / invMassSum;
+			c.impulse = 0.0f;
+
+			if (m_warmStarting) {
+				uint64_t key = MakeKey(contact.a, contact.b);
+				while (cursor < m_cache.size() && m_cache[cursor].key < key) ++cursor;
+				if (cursor < m_cache.size() && m_cache[cursor].key == key) c.impulse = m_cache[cursor].impulse;
+			}
+			m_constraints.push_back(c);
+		}
+
+		// --- 2. EH[X^[giOt[̃CpXɓĂj ---
+		for (const auto& c : m_constraints) {
+			if (c.impulse == 0.0f) continue;
+			XMVECTOR P = XMLoadFloat3(&c.normal) * c.impulse;
+			XMStoreFloat3(&m_velocities[c.bodyA], XMLoadFloat3(&m_velocities[c.bodyA]) - P * m_invMass[c.bodyA]);
+			XMStoreFloat3(&m_velocities[c.bodyB], XMLoadFloat3(&m_velocities[c.bodyB]) + P * m_invMass[c.bodyB]);
+		}
+
+		// --- 3. FiF̒̍Ŝ͓GȂj ---
+		ColorConstraints();
+
+		// F̏ solve ĂԁB傫ȐF̓WuXbhɔziꂽS͍Ō1XbhŁj
+		JobSystem& jobs = JobSystem::Instance();
+		auto forEachColor = [&](auto&& solve) {
+			for (uint32_t color = 0; color <= MaxColors; ++color) {
+				uint32_t begin = m_colorOffsets[color], end = m_colorOffsets[color + 1];
+				if (begin == end) continue;
+				if (!m_parallel || color == MaxColors) {
+					for (uint32_t i = begin; i < end; ++i) solve(m_constraints[m_colorOrder[i]]);
+					continue;
+				}
+				jobs.ParallelFor(end - begin, ColorBatch, [&](uint32_t first, uint32_t last, uint32_t) {
+					for (uint32_t i = begin + first; i < begin + last; ++i) solve(m_constraints[m_colorOrder[i]]);
+					});
+			}
+			};
+
+		// --- 4. x̔  ʒu␳̔ ---
+		for (int it = 0; it < m_iterations; ++it) {
+			forEachColor([this](Constraint& c) { SolveVelocity(c); });
+		}
+		for (int it = 0; it < m_iterations; ++it) {
+			forEachColor([this](Constraint& c) { SolvePosition(c); });
+		}
+
+		// --- 5. t[pɗݐσCpXoicontacts Ɠ (a, b) ̏j ---
+		m_cacheScratch.clear();
+		for (const auto& c : m_constraints) {
+			if (c.impulse > 0.0f) m_cacheScratch.push_back({ MakeKey(m_entities[c.bodyA], m_entities[c.bodyB]), c.impulse });
+		}
+		m_cache.swap(m_cacheScratch);
+
+		// --- 6. ߂îj ---
+		auto writeBack = [this](uint32_t begin, uint32_t end, uint32_t) {
+			for (uint32_t i = begin; i < end; ++i) {
+				if (!m_rigidbodies[i]) continue;
+				m_rigidbodies[i]->velocity = m_velocities[i];
+
+				XMFLOAT3& pos = m_transforms[i]->position;
+				const XMFLOAT3& delta = m_positionDeltas[i];
+				pos.x += delta.x;
+				pos.y += delta.y;
+				pos.z += delta.z;
+			}
+			};
+		if (m_parallel) jobs.ParallelFor((uint32_t)m_entities.size(), BodyBatch, writeBack);
+		else writeBack(0, (uint32_t)m_entities.size(), 0);
+	}
+}
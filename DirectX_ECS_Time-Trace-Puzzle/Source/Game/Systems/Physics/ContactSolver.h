@@ -0,0 +1,140 @@
+/*****************************************************************//**
+ * @file	ContactSolver.h
+ * @brief	ڐG̉iCpX@ + EH[X^[gj
+ *
+ * @details
+ * ڐGɏoĂ鍄̂xW߂āA\o[p̔ԍň
+ * AzixEʒu̕␳ʁEtʁjɋl߂܂B
+ * ̏Ŗ@̃CpXw񐔂JԂiݐϒl 0 ȏɐjA
+ * ߂荞݂̈ʒu␳񐔂JԂĂAŌɂ܂Ƃ߂ Rigidbody / Transform ɏ߂܂B
+ * Ot[̗ݐσCpX Entity ̑gƂɊoĂAŏɓĂĂiEH[X^[gĵŁA
+ * ςݏd˂̂Ȃ񐔂ł܂B
+ *
+ * ŚuF̒ł͓̂LȂv悤ɐFi×~@̃OtʐFjĂ܂B
+ * F̍S݂͌ɉeȂ̂ŁAFƂɃWuXbh֔zĕɉAF̏ɐi߂܂B
+ * Ԃ͐FŌ܂̂ŁAXbh̃I / Itɂ炸ʂ͓ɂȂ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	Rigidbody Ȃ蔻́AȂiʖjƂĈ܂B
+ *********************************************************************/
+
+#ifndef ___CONTACT_SOLVER_H___
+#define ___CONTACT_SOLVER_H___
+
+// ===== CN[h =====
+#include "Engine/ECS/ECS.h"
+#include "Game/Components/Components.h"
+#include "Game/Systems/Physics/PhysicsSystem.h"
+#include <vector>
+#include <cstdint>
+
+namespace Physics
+{
+	/**
+	 * @class	ContactSolver
+	 * @brief	ڐG̔z񂩂瑬xƈʒu␳
+	 */
+	class ContactSolver
+	{
+	public:
+		// x̔񐔁iقǐmdj
+		static constexpr int DefaultIterations = 4;
+
+		// contacts  (a, b) ̏ɕł邱ƁiEH[X^[g̑ΉtɎgj
+		void Solve(Registry& registry, const std::vector<Contact>& contacts);
+
+		void SetIterations(int iterations) { m_iterations = iterations < 1 ? 1 : iterations; }
+		int GetIterations() const { return m_iterations; }
+
+		void SetWarmStarting(bool enable) { m_warmStarting = enable; }
+		bool IsWarmStarting() const { return m_warmStarting; }
+
+		// FƂ̐̕؂ւiItłF̏ɉ̂Ōʂ͓j
+		void SetParallel(bool enable) { m_parallel = enable; }
+		bool IsParallel() const { return m_parallel; }
+
+		// Ot[̗ݐσCpX̂ĂiV[؂ւȂǁj
+		void ClearCache() { m_cache.clear(); }
+
+		// O Solve ŉ́EڐG̐imFpj
+		size_t GetBodyCount() const { return m_invMass.size(); }
+		size_t GetConstraintCount() const { return m_constraints.size(); }
+		// O Solve ŎgF̐ƁAF肸1XbhŉS̐imFpj
+		uint32_t GetColorCount() const { return m_colorCount; }
+		size_t GetOverflowCount() const { return m_colorOffsets.empty() ? 0 : m_colorOffsets[MaxColors + 1] - m_colorOffsets[MaxColors]; }
+
+	private:
+		// F̐̏îƂ̎gF 64bit ŎjBꂽS͍Ō1Xbhŉ
+		static constexpr uint32_t MaxColors = 64;
+
+		/**
+		 * @struct	Constraint
+		 * @brief	1̐ڐG̍S
+		 */
+		struct Constraint
+		{
+			uint32_t bodyA;
+			uint32_t bodyB;
+			DirectX::XMFLOAT3 normal;	// A -> B
+			float depth;
+			float normalMass;			// 1 / (tA + tB)
+			float impulse;				// ݐσCpXi0 ȏj
+		};
+
+		/**
+		 * @struct	CachedImpulse
+		 * @brief	Ot[̗ݐσCpX
+		 */
+		struct CachedImpulse
+		{
+			uint64_t key;	// (a << 32) | b
+			float impulse;
+		};
+
+		// entity ̃\o[pԍi߂ďoĂzɒǉj
+		uint32_t GetBodyId(Registry& registry, Entity entity);
+
+		// SFAF̏ɕׂԍim_colorOrderjƐFƂ͈̔́im_colorOffsetsj
+		void ColorConstraints();
+
+		// 1̍S̑xEʒuiF̒ȂʃXbh瓯ɌĂł悢j
+		void SolveVelocity(Constraint& c);
+		void SolvePosition(const Constraint& c);
+
+		int m_iterations = DefaultIterations;
+		bool m_warmStarting = true;
+		bool m_parallel = true;
+
+		// \o[p̍́iԍňAzj
+		std::vector<uint32_t> m_bodyIds;			// Entity -> \o[ԍigp InvalidIdj
+		std::vector<Entity> m_entities;
+		std::vector<float> m_invMass;				// 0 Ȃ瓮Ȃ
+		std::vector<DirectX::XMFLOAT3> m_velocities;
+		std::vector<DirectX::XMFLOAT3> m_positionDeltas;
+		std::vector<Rigidbody*> m_rigidbodies;		// ߂iȂ̂ nullptrj
+		std::vector<Transform*> m_transforms;
+
+		std::vector<Constraint> m_constraints;
+		std::vector<CachedImpulse> m_cache;			// key ̏
+		std::vector<CachedImpulse> m_cacheScratch;
+
+		// F
+		std::vector<uint64_t> m_bodyColors;			// ̂Ƃ̎gFirbgj
+		std::vector<uint8_t> m_constraintColors;	// SƂ̐FiMaxColors ͈j
+		std::vector<uint32_t> m_colorOrder;			// F̏ɕׂS̔ԍ
+		std::vector<uint32_t> m_colorOffsets;		// F i ̍S m_colorOrder[m_colorOffsets[i] .. m_colorOffsets[i + 1])
+		std::vector<uint32_t> m_colorCursor;		// ׂ鎞݈̏ʒu
+		uint32_t m_colorCount = 0;
+	};
+}
+
+#endif // !___CONTACT_SOLVER_H___
@@ -0,0 +1,93 @@
+/*****************************************************************//**
+ * @file	Determinism.cpp
+ * @brief	_[hi͂ȂrbgPʂœʂɂȂ镨j̐ݒƏԂ̃`FbNT
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/Determinism.h"
+#include "Game/Components/Components.h"
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+namespace Physics
+{
+	int Determinism::ConsumeSteps(float frameDeltaTime)
+	{
+		if (frameDeltaTime <= 0.0f) return 0;
+
+		m_accumulator += frameDeltaTime;
+		int steps = 0;
+		while (m_accumulator >= FixedDeltaTime && steps < MaxStepsPerFrame) {
+			m_accumulator -= FixedDeltaTime;
+			++steps;
+		}
+
+		// ŎoȂ͎̂Ăi]肾cj
+		if (m_accumulator >= FixedDeltaTime) m_accumulator = std::fmod(m_accumulator, FixedDeltaTime);
+		return steps;
+	}
+
+	namespace
+	{
+		constexpr uint64_t FnvOffset = 1469598103934665603ull;
+		constexpr uint64_t FnvPrime = 1099511628211ull;
+
+		void HashBytes(uint64_t& hash, const void* data, size_t size)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; ++i) {
+				hash ^= bytes[i];
+				hash *= FnvPrime;
+			}
+		}
+
+		// float ̓rbĝ܂܍i-0  +0ENaN ̈Ⴂʂj
+		void HashFloat3(uint64_t& hash, const DirectX::XMFLOAT3& v)
+		{
+			uint32_t bits[3];
+			std::memcpy(&bits[0], &v.x, sizeof(float));
+			std::memcpy(&bits[1], &v.y, sizeof(float));
+			std::memcpy(&bits[2], &v.z, sizeof(float));
+			HashBytes(hash, bits, sizeof(bits));
+		}
+	}
+
+	uint64_t ComputeStateChecksum(Registry& registry, std::vector<Entity>& scratch)
+	{
+		// i[ɂȂ悤 Entity ̏ɕׂ
+		scratch.clear();
+		registry.view<Transform, Rigidbody>([&](Entity e, Transform&, Rigidbody&) { scratch.push_back(e); });
+		std::sort(scratch.begin(), scratch.end());
+
+		uint64_t hash = FnvOffset;
+		for (Entity e : scratch) {
+			const Transform& t = registry.get<Transform>(e);
+			const Rigidbody& rb = registry.get<Rigidbody>(e);
+
+			HashBytes(hash, &e, sizeof(e));
+			HashFloat3(hash, t.position);
+			HashFloat3(hash, t.rotation);
+			HashFloat3(hash, rb.velocity);
+			const uint8_t sleeping = rb.isSleeping ? 1 : 0;
+			HashBytes(hash, &sleeping, sizeof(sleeping));
+		}
+		return hash;
+	}
+}
@@ -0,0 +1,99 @@
+/*****************************************************************//**
+ * @file	Determinism.h
+ * @brief	_[hi͂ȂrbgPʂœʂɂȂ镨j̐ݒƏԂ̃`FbNT
+ *
+ * @details
+ * pỸvC⊪߂̂߂ɁAxsĂEXbhςĂ
+ * ̌ʂrbgPʂœɂȂ郂[hłB
+ * - ̂ Entity ̏ɕׂďiRegistry ̊i[E폜̓ւɂȂj
+ * - ڐG Entity ̑g̏ɕׂĂiXbhEzɂȂj
+ * -  .cpp  FMA ւ̏kEfast-math ȂiStrictFloat.hj
+ * - LȊԂ́At[̌oߎԂ𗭂߂ FixedDeltaTime  0 ` MaxStepsPerFrame i߂iŒXebvj
+ * בւƏk̋֎~͏ɗLŁA[hŐ؂ւ̂͌ŒXebvƃ`FbNTłB
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	ŒXebv CollisionSystem::Update 񂵂܂iϕ -> svZ -> 蔻 1XebvƂČJԂjB
+ *			̃[hł PhysicsSystem::Update ͉Ȃ̂ŁACollisionSystem ̖ʂł͕i݂܂B
+ *			1t[ MaxStepsPerFrame 𒴂镪͎̂Ă̂ŁA̎Q[̎Ԃx܂B
+ *********************************************************************/
+
+#ifndef ___DETERMINISM_H___
+#define ___DETERMINISM_H___
+
+// ===== CN[h =====
+#include "Engine/ECS/ECS.h"
+#include <vector>
+#include <cstdint>
+
+namespace Physics
+{
+	/**
+	 * @class	Determinism
+	 * @brief	_[h̐ݒivWFNgʁj
+	 */
+	class Determinism
+	{
+	public:
+		// _[h1Xebv̎ [s]
+		static constexpr float FixedDeltaTime = 1.0f / 60.0f;
+		// 1t[ɐi߂Xebv̏iɁAǂƂĂɏdȂ̂hj
+		static constexpr int MaxStepsPerFrame = 4;
+
+		static Determinism& Instance()
+		{
+			static Determinism instance;
+			return instance;
+		}
+
+		void SetEnabled(bool enable) { m_enabled = enable; m_accumulator = 0.0f; }
+		bool IsEnabled() const { return m_enabled; }
+
+		/**
+		 * @brief	t[̌oߎԂ𗭂߁Ãt[ FixedDeltaTime Ői߂Xebv̐Ԃit[1񂾂Ăԁj
+		 * @details	܂Ԃ FixedDeltaTime oA]͎̃t[Ɏz܂i0 ̃t[jB
+		 *			MaxStepsPerFrame ŎoȂ͎̂Ă܂Bꎞ~i0 ȉj͗߂܂B
+		 */
+		int ConsumeSteps(float frameDeltaTime);
+
+		// zĂ鎞 [s]i0 ` FixedDeltaTimeB`̕ԂȂǂɎgj
+		float GetAccumulator() const { return m_accumulator; }
+
+	private:
+		Determinism() = default;
+
+		bool m_enabled = false;
+		float m_accumulator = 0.0f;
+	};
+
+	/**
+	 * @brief	̂̏ԁiʒuE]ExEj Entity ̏ɃnbViFNV-1aj
+	 * @param	scratch		Entity ׂƗpiĂԑŎg񂷁j
+	 */
+	uint64_t ComputeStateChecksum(Registry& registry, std::vector<Entity>& scratch);
+
+	/**
+	 * @struct	DeterminismCheckResult
+	 * @brief	ʂςČJԂAt[Ƃ̃`FbNTׂ
+	 */
+	struct DeterminismCheckResult
+	{
+		size_t bodies = 0;
+		int frames = 0;
+		int runs = 0;						// ׂs̐
+		uint64_t finalChecksum = 0;			// ̎s̍Ō̃t[
+		int firstMismatchFrame = -1;		// vȂŏ̃t[iv -1j
+		int mismatchRun = -1;				// vȂs̔ԍ
+		bool matches = true;
+	};
+}
+
+#endif // !___DETERMINISM_H___
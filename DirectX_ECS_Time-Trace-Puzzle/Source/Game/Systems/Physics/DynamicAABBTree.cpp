@@ -0,0 +1,311 @@
+/*****************************************************************//**
+ * @file	DynamicAABBTree.cpp
+ * @brief	IAABBc[ioEfBO{[Kwj
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/DynamicAABBTree.h"
+#include <cassert>
+
+namespace Physics
+{
+	int32_t DynamicAABBTree::CreateProxy(const AABB& aabb, uint32_t userData)
+	{
+		int32_t id = AllocateNode();
+		Node& node = m_nodes[id];
+		node.aabb = {
+			{ aabb.min.x - m_margin, aabb.min.y - m_margin, aabb.min.z - m_margin },
+			{ aabb.max.x + m_margin, aabb.max.y + m_margin, aabb.max.z + m_margin }
+		};
+		node.userData = userData;
+		node.height = 0;
+
+		InsertLeaf(id);
+		return id;
+	}
+
+	void DynamicAABBTree::DestroyProxy(int32_t proxyId)
+	{
+		assert(m_nodes[proxyId].IsLeaf());
+		RemoveLeaf(proxyId);
+		FreeNode(proxyId);
+	}
+
+	bool DynamicAABBTree::MoveProxy(int32_t proxyId, const AABB& aabb)
+	{
+		assert(m_nodes[proxyId].IsLeaf());
+
+		// ܂ fat AABB ̒Ȃ牽Ȃ
+		if (m_nodes[proxyId].aabb.Contains(aabb)) return false;
+
+		RemoveLeaf(proxyId);
+		m_nodes[proxyId].aabb = {
+			{ aabb.min.x - m_margin, aabb.min.y - m_margin, aabb.min.z - m_margin },
+			{ aabb.max.x + m_margin, aabb.max.y + m_margin, aabb.max.z + m_margin }
+		};
+		InsertLeaf(proxyId);
+		return true;
+	}
+
+	void DynamicAABBTree::Clear()
+	{
+		m_nodes.clear();
+		m_root = NullNode;
+		m_freeList = NullNode;
+	}
+
+	int32_t DynamicAABBTree::AllocateNode()
+	{
+		if (m_freeList == NullNode)
+		{
+			m_nodes.emplace_back();
+			return (int32_t)m_nodes.size() - 1;
+		}
+
+		int32_t id = m_freeList;
+		m_freeList = m_nodes[id].parent;
+		m_nodes[id] = Node();
+		return id;
+	}
+
+	void DynamicAABBTree::FreeNode(int32_t id)
+	{
+		m_nodes[id].parent = m_freeList;
+		m_nodes[id].height = -1;
+		m_freeList = id;
+	}
+
+	void DynamicAABBTree::InsertLeaf(int32_t leaf)
+	{
+		if (m_root == NullNode)
+		{
+			m_root = leaf;
+			m_nodes[leaf].parent = NullNode;
+			return;
+		}
+
+		// --- 1. \ʐσq[XeBbNŌZm[hI ---
+		const AABB leafAABB = m_nodes[leaf].aabb;
+		int32_t index = m_root;
+		while (!m_nodes[index].IsLeaf())
+		{
+			const Node& node = m_nodes[index];
+			float area = node.aabb.SurfaceArea();
+			float combinedArea = AABB::Union(node.aabb, leafAABB).SurfaceArea();
+
+			// ŐVeRXg
+			float cost = 2.0f * combinedArea;
+			// ɍ~ꍇɁÃm[h傫Ȃ镪̃RXg
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			auto childCost = [&](int32_t child)
+				{
+					const Node& c = m_nodes[child];
+					float unionArea = AABB::Union(leafAABB, c.aabb).SurfaceArea();
+					return c.IsLeaf() ? unionArea + inheritanceCost : (unionArea - c.aabb.SurfaceArea()) + inheritanceCost;
+				};
+			float cost1 = childCost(node.child1);
+			float cost2 = childCost(node.child2);
+
+			if (cost < cost1 && cost < cost2) break;
+			index = (cost1 < cost2) ? node.child1 : node.child2;
+		}
+		int32_t sibling = index;
+
+		// --- 2. VeAZƗtԂ牺 ---
+		int32_t newParent = AllocateNode();	//  m_nodes Ċmۂ\
+		int32_t oldParent = m_nodes[sibling].parent;
+		Node& parent = m_nodes[newParent];
+		parent.parent = oldParent;
+		parent.aabb = AABB::Union(leafAABB, m_nodes[sibling].aabb);
+		parent.height = m_nodes[sibling].height + 1;
+		parent.child1 = sibling;
+		parent.child2 = leaf;
+
+		if (oldParent != NullNode)
+		{
+			if (m_nodes[oldParent].child1 == sibling) m_nodes[oldParent].child1 = newParent;
+			else m_nodes[oldParent].child2 = newParent;
+		}
+		else
+		{
+			m_root = newParent;
+		}
+		m_nodes[sibling].parent = newParent;
+		m_nodes[leaf].parent = newParent;
+
+		// --- 3. ܂Ŗ߂ȂoXAABBXV ---
+		Refit(m_nodes[leaf].parent);
+	}
+
+	void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = NullNode;
+			return;
+		}
+
+		int32_t parent = m_nodes[leaf].parent;
+		int32_t grandParent = m_nodes[parent].parent;
+		int32_t sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+		if (grandParent != NullNode)
+		{
+			// eāAZcɒڂȂ
+			if (m_nodes[grandParent].child1 == parent) m_nodes[grandParent].child1 = sibling;
+			else m_nodes[grandParent].child2 = sibling;
+			m_nodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			Refit(grandParent);
+		}
+		else
+		{
+			m_root = sibling;
+			m_nodes[sibling].parent = NullNode;
+			FreeNode(parent);
+		}
+	}
+
+	void DynamicAABBTree::Refit(int32_t index)
+	{
+		while (index != NullNode)
+		{
+			index = Balance(index);
+
+			Node& node = m_nodes[index];
+			const Node& c1 = m_nodes[node.child1];
+			const Node& c2 = m_nodes[node.child2];
+			node.height = 1 + std::max(c1.height, c2.height);
+			node.aabb = AABB::Union(c1.aabb, c2.aabb);
+
+			index = node.parent;
+		}
+	}
+
+	// E̍̍2ȏȂ]iAVL؂ƓljB]̕؂̍Ԃ
+	int32_t DynamicAABBTree::Balance(int32_t iA)
+	{
+		Node* A = &m_nodes[iA];
+		if (A->IsLeaf() || A->height < 2) return iA;
+
+		int32_t iB = A->child1;
+		int32_t iC = A->child2;
+		Node* B = &m_nodes[iB];
+		Node* C = &m_nodes[iC];
+
+		int32_t balance = C->height - B->height;
+
+		// C グ
+		if (balance > 1)
+		{
+			int32_t iF = C->child1;
+			int32_t iG = C->child2;
+			Node* F = &m_nodes[iF];
+			Node* G = &m_nodes[iG];
+
+			// A  C ւ
+			C->child1 = iA;
+			C->parent = A->parent;
+			A->parent = iC;
+
+			if (C->parent != NullNode)
+			{
+				if (m_nodes[C->parent].child1 == iA) m_nodes[C->parent].child1 = iC;
+				else m_nodes[C->parent].child2 = iC;
+			}
+			else
+			{
+				m_root = iC;
+			}
+
+			// ̑ C ɎcAႢ A Ɉڂ
+			if (F->height > G->height)
+			{
+				C->child2 = iF;
+				A->child2 = iG;
+				G->parent = iA;
+				A->aabb = AABB::Union(B->aabb, G->aabb);
+				C->aabb = AABB::Union(A->aabb, F->aabb);
+				A->height = 1 + std::max(B->height, G->height);
+				C->height = 1 + std::max(A->height, F->height);
+			}
+			else
+			{
+				C->child2 = iG;
+				A->child2 = iF;
+				F->parent = iA;
+				A->aabb = AABB::Union(B->aabb, F->aabb);
+				C->aabb = AABB::Union(A->aabb, G->aabb);
+				A->height = 1 + std::max(B->height, F->height);
+				C->height = 1 + std::max(A->height, G->height);
+			}
+			return iC;
+		}
+
+		// B グ
+		if (balance < -1)
+		{
+			int32_t iD = B->child1;
+			int32_t iE = B->child2;
+			Node* D = &m_nodes[iD];
+			Node* E = &m_nodes[iE];
+
+			// A  B ւ
+			B->child1 = iA;
+			B->parent = A->parent;
+			A->parent = iB;
+
+			if (B->parent != NullNode)
+			{
+				if (m_nodes[B->parent].child1 == iA) m_nodes[B->parent].child1 = iB;
+				else m_nodes[B->parent].child2 = iB;
+			}
+			else
+			{
+				m_root = iB;
+			}
+
+			if (D->height > E->height)
+			{
+				B->child2 = iD;
+				A->child1 = iE;
+				E->parent = iA;
+				A->aabb = AABB::Union(C->aabb, E->aabb);
+				B->aabb = AABB::Union(A->aabb, D->aabb);
+				A->height = 1 + std::max(C->height, E->height);
+				B->height = 1 + std::max(A->height, D->height);
+			}
+			else
+			{
+				B->child2 = iE;
+				A->child1 = iD;
+				D->parent = iA;
+				A->aabb = AABB::Union(C->aabb, D->aabb);
+				B->aabb = AABB::Union(A->aabb, E->aabb);
+				A->height = 1 + std::max(C->height, D->height);
+				B->height = 1 + std::max(A->height, E->height);
+			}
+			return iB;
+		}
+
+		return iA;
+	}
+}
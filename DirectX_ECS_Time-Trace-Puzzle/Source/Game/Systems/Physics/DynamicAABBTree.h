@@ -0,0 +1,248 @@
+/*****************************************************************//**
+ * @file	DynamicAABBTree.h
+ * @brief	IAABBc[ioEfBO{[Kwj
+ *
+ * @details
+ * tɁu点AABBifat AABBjv񕪖؂łB
+ * E}͕\ʐσq[XeBbNiSAHjŌZm[hIт܂
+ * E}E폜̂тɉ]ŃoX܂
+ * Ê fat AABB ͂ݏođ}̂ŁAȂ؂͕ω܂
+ * 傫̈Ⴄ́iȏƏȔȂǁjĂĂ肱ڂ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___DYNAMIC_AABB_TREE_H___
+#define ___DYNAMIC_AABB_TREE_H___
+
+// ===== CN[h =====
+#include <DirectXMath.h>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+namespace Physics
+{
+	/**
+	 * @struct	AABB
+	 * @brief	sE{bNX
+	 */
+	struct AABB
+	{
+		DirectX::XMFLOAT3 min;
+		DirectX::XMFLOAT3 max;
+
+		float SurfaceArea() const
+		{
+			float dx = max.x - min.x, dy = max.y - min.y, dz = max.z - min.z;
+			return 2.0f * (dx * dy + dy * dz + dz * dx);
+		}
+
+		bool Contains(const AABB& o) const
+		{
+			return	min.x <= o.min.x && min.y <= o.min.y && min.z <= o.min.z &&
+				o.max.x <= max.x && o.max.y <= max.y && o.max.z <= max.z;
+		}
+
+		bool Overlaps(const AABB& o) const
+		{
+			return	!(max.x < o.min.x || o.max.x < min.x ||
+				max.y < o.min.y || o.max.y < min.y ||
+				max.z < o.min.z || o.max.z < min.z);
+		}
+
+		static AABB Union(const AABB& a, const AABB& b)
+		{
+			return {
+				{ std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) },
+				{ std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) }
+			};
+		}
+
+		/**
+		 * @brief	CƂ̌iXu@j
+		 * @param	invDir	C̋ti0 }INFINITYj
+		 * @return	[0, maxDist] ͈̔͂Ō邩
+		 */
+		bool IntersectRay(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& invDir, float maxDist) const
+		{
+			float tMin = 0.0f, tMax = maxDist;
+			const float o[3] = { origin.x, origin.y, origin.z };
+			const float inv[3] = { invDir.x, invDir.y, invDir.z };
+			const float mn[3] = { min.x, min.y, min.z };
+			const float mx[3] = { max.x, max.y, max.z };
+			for (int k = 0; k < 3; ++k)
+			{
+				float t1 = (mn[k] - o[k]) * inv[k];
+				float t2 = (mx[k] - o[k]) * inv[k];
+				// 0 * INFINITY = NaN ɂȂꍇi_ʏj͖
+				tMin = std::max(tMin, std::min(t1, t2));
+				tMax = std::min(tMax, std::max(t1, t2));
+			}
+			return tMin <= tMax;
+		}
+	};
+
+	/**
+	 * @class	DynamicAABBTree
+	 * @brief	IAABBc[
+	 */
+	class DynamicAABBTree
+	{
+	public:
+		static constexpr int32_t NullNode = -1;
+
+		explicit DynamicAABBTree(float margin = 0.1f) : m_margin(margin) {}
+
+		// tǉiaabb  margin 点ĕێj
+		int32_t CreateProxy(const AABB& aabb, uint32_t userData);
+		void DestroyProxy(int32_t proxyId);
+
+		// AABB̍XVBfat AABB ͂ݏođ} true Ԃ
+		bool MoveProxy(int32_t proxyId, const AABB& aabb);
+
+		// Lȗtijς݁Em[hȂ falsej
+		bool IsProxy(int32_t id) const { return id >= 0 && id < (int32_t)m_nodes.size() && m_nodes[id].height == 0; }
+
+		uint32_t GetUserData(int32_t proxyId) const { return m_nodes[proxyId].userData; }
+		void SetUserData(int32_t proxyId, uint32_t userData) { m_nodes[proxyId].userData = userData; }
+		const AABB& GetFatAABB(int32_t proxyId) const { return m_nodes[proxyId].aabb; }
+
+		int32_t GetHeight() const { return m_root == NullNode ? 0 : m_nodes[m_root].height; }
+		void Clear();
+
+		/**
+		 * @brief	aabb  fat AABB dȂt
+		 * @param	func	bool(int32_t proxyId)Bfalse ԂƑł؂
+		 */
+		template<typename Func>
+		void Query(const AABB& aabb, Func func) const
+		{
+			TraversalStack stack;
+			if (m_root != NullNode) stack.Push(m_root);
+
+			while (!stack.Empty())
+			{
+				int32_t id = stack.Pop();
+				const Node& node = m_nodes[id];
+				if (!node.aabb.Overlaps(aabb)) continue;
+
+				if (node.IsLeaf())
+				{
+					if (!func(id)) return;
+				}
+				else
+				{
+					stack.Push(node.child1);
+					stack.Push(node.child2);
+				}
+			}
+		}
+
+		/**
+		 * @brief	C fat AABB t
+		 * @param	dir		Kς݂̌
+		 * @param	func	float(int32_t proxyId, float maxDist)B
+		 *					Vő勗Ԃiŋߐڂ̂ݗ~ꍇ͓A0 őł؂j
+		 */
+		template<typename Func>
+		void RayCast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dir, float maxDist, Func func) const
+		{
+			DirectX::XMFLOAT3 invDir = {
+				dir.x != 0.0f ? 1.0f / dir.x : INFINITY,
+				dir.y != 0.0f ? 1.0f / dir.y : INFINITY,
+				dir.z != 0.0f ? 1.0f / dir.z : INFINITY
+			};
+
+			TraversalStack stack;
+			if (m_root != NullNode) stack.Push(m_root);
+
+			while (!stack.Empty())
+			{
+				int32_t id = stack.Pop();
+				const Node& node = m_nodes[id];
+				if (!node.aabb.IntersectRay(origin, invDir, maxDist)) continue;
+
+				if (node.IsLeaf())
+				{
+					maxDist = func(id, maxDist);
+					if (maxDist <= 0.0f) return;
+				}
+				else
+				{
+					stack.Push(node.child1);
+					stack.Push(node.child2);
+				}
+			}
+		}
+
+	private:
+		// TpX^bŇŒ蒷i]ŃoX̂ō log n xj
+		static constexpr int32_t StackSize = 256;
+
+		/**
+		 * @struct	TraversalStack
+		 * @brief	TpX^bNBStackSize 𒴂̓q[vɑޔ܂im[h肱ڂȂj
+		 */
+		struct TraversalStack
+		{
+			int32_t items[StackSize];
+			int32_t count = 0;
+			std::vector<int32_t> spill;	// ʏ͎gȂ
+
+			bool Empty() const { return count == 0 && spill.empty(); }
+			void Push(int32_t id)
+			{
+				if (count < StackSize) items[count++] = id;
+				else spill.push_back(id);
+			}
+			int32_t Pop()
+			{
+				if (!spill.empty())
+				{
+					int32_t id = spill.back();
+					spill.pop_back();
+					return id;
+				}
+				return items[--count];
+			}
+		};
+
+		struct Node
+		{
+			AABB aabb;
+			uint32_t userData = 0;
+			int32_t parent = NullNode;	// gpm[hł͎̋󂫃m[h
+			int32_t child1 = NullNode;
+			int32_t child2 = NullNode;
+			int32_t height = -1;		// t = 0Agp = -1
+
+			bool IsLeaf() const { return child1 == NullNode; }
+		};
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t id);
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		int32_t Balance(int32_t iA);
+		void Refit(int32_t index);	// index 獪܂ł AABB ƍXV
+
+		std::vector<Node> m_nodes;
+		int32_t m_root = NullNode;
+		int32_t m_freeList = NullNode;
+		float m_margin;
+	};
+}
+
+#endif // !___DYNAMIC_AABB_TREE_H___
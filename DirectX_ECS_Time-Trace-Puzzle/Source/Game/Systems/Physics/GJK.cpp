@@ -0,0 +1,623 @@
+/*****************************************************************//**
+ * @file	GJK.cpp
+ * @brief	T|[g֐ɂʌ`󓯎m̔iGJK ̋ + EPA ̂߂荞݁j
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/GJK.h"
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace Physics
+{
+	namespace
+	{
+		constexpr int MaxIterations = 32;			// GJK ̔񐔂̏
+		constexpr float RelativeTolerance = 1e-5f;	// ̏Ɖ̍̊菬Ύ
+		constexpr float DistanceTolerance = 1e-4f;	// V ̒ [m] 菬Ύi~̉ȂǋȖʂ͎x̂Łj
+		constexpr float EpaTolerance = 1e-4f;		// EPA LĂʂȏ [m] ȂΎ
+		constexpr int EpaMaxIterations = 32;
+		constexpr int EpaMaxVertices = 4 + EpaMaxIterations;
+		constexpr int EpaMaxFaces = 128;
+
+		float Dot(FXMVECTOR a, FXMVECTOR b) { return XMVectorGetX(XMVector3Dot(a, b)); }
+
+		/**
+		 * @struct	Vertex
+		 * @brief	~RtXL[ A - B ̓_ƁA߂ĩt[̏o_Ɏgj
+		 */
+		struct Vertex
+		{
+			XMVECTOR w;
+			XMVECTOR dir;
+		};
+
+		/**
+		 * @struct	Simplex
+		 * @brief	GJK ̒Ṕi_EEOp`Elʑ́j
+		 */
+		struct Simplex
+		{
+			Vertex v[4];
+			int count = 0;
+
+			// _ic_E̎ɂ悭oj͓Ȃ
+			bool Add(const Vertex& vertex)
+			{
+				for (int i = 0; i < count; ++i) {
+					if (XMVectorGetX(XMVector3LengthSq(vertex.w - v[i].w)) < 1e-12f) return false;
+				}
+				v[count++] = vertex;
+				return true;
+			}
+		};
+
+		/**
+		 * @struct	Shape
+		 * @brief	肷`FCollider AbV̎Op`1iOp`͐ĉ́Ea 0j
+		 */
+		struct Shape
+		{
+			const CollisionProxy* proxy;	// nullptr Ȃ triangle
+			XMVECTOR triangle[3];
+		};
+
+		Shape MakeShape(const CollisionProxy& p)
+		{
+			Shape shape;
+			shape.proxy = &p;
+			return shape;
+		}
+
+		XMVECTOR Center(const Shape& shape)
+		{
+			if (!shape.proxy) return (shape.triangle[0] + shape.triangle[1] + shape.triangle[2]) * (1.0f / 3.0f);
+
+			const CollisionProxy& p = *shape.proxy;
+			switch (p.type) {
+			case ColliderType::Sphere: return XMLoadFloat3(&p.sphere.center);
+			case ColliderType::Box: return XMLoadFloat3(&p.obb.center);
+			case ColliderType::Capsule: return (XMLoadFloat3(&p.capsule.start) + XMLoadFloat3(&p.capsule.end)) * 0.5f;
+			case ColliderType::Cylinder: return XMLoadFloat3(&p.cylinder.center);
+			case ColliderType::Mesh: break;	// Op`Ƃɔ肷iCollisionSystem::CheckMeshj
+			}
+			return XMVectorZero();
+		}
+
+		XMVECTOR SupportOf(const Shape& shape, FXMVECTOR direction)
+		{
+			if (shape.proxy) return SupportCore(*shape.proxy, direction);
+
+			float d0 = Dot(shape.triangle[0], direction);
+			float d1 = Dot(shape.triangle[1], direction);
+			float d2 = Dot(shape.triangle[2], direction);
+			if (d0 >= d1 && d0 >= d2) return shape.triangle[0];
+			return d1 >= d2 ? shape.triangle[1] : shape.triangle[2];
+		}
+
+		float RadiusOf(const Shape& shape) { return shape.proxy ? CoreRadius(*shape.proxy) : 0.0f; }
+
+		// A - B  direction ̃T|[g_
+		Vertex Support(const Shape& a, const Shape& b, FXMVECTOR direction)
+		{
+			Vertex vertex;
+			vertex.w = SupportOf(a, direction) - SupportOf(b, -direction);
+			vertex.dir = direction;
+			return vertex;
+		}
+
+		// --- P̂̒Ō_Ɉԋ߂_iP̂͂̓_܂ވԏʁEӁE_ɏk߂j ---
+		XMVECTOR ClosestOnSegment(Simplex& s)
+		{
+			XMVECTOR a = s.v[0].w, ab = s.v[1].w - a;
+			float denom = Dot(ab, ab);
+			float t = denom > 0.0f ? -Dot(a, ab) / denom : 0.0f;
+			if (t <= 0.0f) { s.count = 1; return a; }
+			if (t >= 1.0f) { s.v[0] = s.v[1]; s.count = 1; return s.v[0].w; }
+			return a + ab * t;
+		}
+
+		XMVECTOR ClosestOnTriangle(Simplex& s)
+		{
+			// Real-Time Collision Detection 5.1.5 ̓__ɂ
+			const Vertex A = s.v[0], B = s.v[1], C = s.v[2];
+			XMVECTOR a = A.w, b = B.w, c = C.w;
+			XMVECTOR ab = b - a, ac = c - a;
+
+			float d1 = -Dot(ab, a), d2 = -Dot(ac, a);
+			if (d1 <= 0.0f && d2 <= 0.0f) { s.count = 1; return a; }
+
+			float d3 = -Dot(ab, b), d4 = -Dot(ac, b);
+			if (d3 >= 0.0f && d4 <= d3) { s.v[0] = B; s.count = 1; return b; }
+
+			float vc = d1 * d4 - d3 * d2;
+			if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+				s.count = 2;
+				return a + ab * (d1 / (d1 - d3));
+			}
+
+			float d5 = -Dot(ab, c), d6 = -Dot(ac, c);
+			if (d6 >= 0.0f && d5 <= d6) { s.v[0] = C; s.count = 1; return c; }
+
+			float vb = d5 * d2 - d1 * d6;
+			if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+				s.v[1] = C; s.count = 2;
+				return a + ac * (d2 / (d2 - d6));
+			}
+
+			float va = d3 * d6 - d5 * d4;
+			if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+				s.v[0] = B; s.v[1] = C; s.count = 2;
+				return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+			}
+
+			float sum = va + vb + vc;
+			if (sum <= 1e-20f) {
+				// ԂꂽOp`́Aԋ߂ӂɂ
+				Simplex best; XMVECTOR bestPoint = a; float bestDist = FLT_MAX;
+				const Vertex edges[3][2] = { { A, B }, { A, C }, { B, C } };
+				for (const auto& edge : edges) {
+					Simplex e; e.v[0] = edge[0]; e.v[1] = edge[1]; e.count = 2;
+					XMVECTOR p = ClosestOnSegment(e);
+					float dist = Dot(p, p);
+					if (dist < bestDist) { bestDist = dist; bestPoint = p; best = e; }
+				}
+				s = best;
+				return bestPoint;
+			}
+			return a + ab * (vb / sum) + ac * (vc / sum);
+		}
+
+		// _lʑ̂̒Ȃ outInside 𗧂Ă
+		XMVECTOR ClosestOnTetrahedron(Simplex& s, bool& outInside)
+		{
+			const Vertex V[4] = { s.v[0], s.v[1], s.v[2], s.v[3] };
+			//  (i, j, k) ƁA̔΂̒_
+			static const int faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+
+			XMVECTOR a = V[0].w;
+			float volume = Dot(V[3].w - a, XMVector3Cross(V[1].w - a, V[2].w - a));
+			const bool flat = std::abs(volume) < 1e-9f;
+
+			outInside = !flat;
+			XMVECTOR bestPoint = a;
+			float bestDist = FLT_MAX;
+			Simplex best = s;
+			for (const auto& f : faces) {
+				XMVECTOR p = V[f[0]].w;
+				XMVECTOR n = XMVector3Cross(V[f[1]].w - p, V[f[2]].w - p);
+				float originSide = -Dot(p, n);
+				float oppositeSide = Dot(V[f[3]].w - p, n);
+				if (!flat && originSide * oppositeSide >= 0.0f) continue;	// _̖͂ʂ̓
+
+				outInside = false;
+				Simplex t; t.v[0] = V[f[0]]; t.v[1] = V[f[1]]; t.v[2] = V[f[2]]; t.count = 3;
+				XMVECTOR q = ClosestOnTriangle(t);
+				float dist = Dot(q, q);
+				if (dist < bestDist) { bestDist = dist; bestPoint = q; best = t; }
+			}
+			if (outInside) return XMVectorZero();
+			s = best;
+			return bestPoint;
+		}
+
+		XMVECTOR Closest(Simplex& s, bool& outInside)
+		{
+			outInside = false;
+			switch (s.count) {
+			case 1: return s.v[0].w;
+			case 2: return ClosestOnSegment(s);
+			case 3: return ClosestOnTriangle(s);
+			default: return ClosestOnTetrahedron(s, outInside);
+			}
+		}
+
+		// --- _܂ޒP̂lʑ̂ɍLiEPA ̏o_j ---
+		bool BlowUp(const Shape& a, const Shape& b, Simplex& s)
+		{
+			const XMVECTOR axes[6] = {
+				XMVectorSet(1, 0, 0, 0), XMVectorSet(-1, 0, 0, 0), XMVectorSet(0, 1, 0, 0),
+				XMVectorSet(0, -1, 0, 0), XMVectorSet(0, 0, 1, 0), XMVectorSet(0, 0, -1, 0),
+			};
+
+			if (s.count == 1) {
+				for (const auto& axis : axes) {
+					if (s.Add(Support(a, b, axis))) break;
+				}
+				if (s.count < 2) return false;
+			}
+			if (s.count == 2) {
+				// ɐ4Ɏ
+				XMVECTOR line = s.v[1].w - s.v[0].w;
+				XMFLOAT3 l; XMStoreFloat3(&l, XMVectorAbs(line));
+				XMVECTOR least = (l.x <= l.y && l.x <= l.z) ? axes[0] : (l.y <= l.z ? axes[2] : axes[4]);
+				XMVECTOR d1 = XMVector3Normalize(XMVector3Cross(line, least));
+				XMVECTOR d2 = XMVector3Normalize(XMVector3Cross(line, d1));
+				const XMVECTOR dirs[4] = { d1, d2, -d1, -d2 };
+				float lineSq = Dot(line, line);
+				for (const auto& dir : dirs) {
+					Vertex w = Support(a, b, dir);
+					XMVECTOR off = XMVector3Cross(w.w - s.v[0].w, line);
+					if (Dot(off, off) > 1e-12f * lineSq) { s.v[s.count++] = w; break; }
+				}
+				if (s.count < 3) return false;
+			}
+			if (s.count == 3) {
+				XMVECTOR n = XMVector3Cross(s.v[1].w - s.v[0].w, s.v[2].w - s.v[0].w);
+				float nLen = XMVectorGetX(XMVector3Length(n));
+				if (nLen < 1e-12f) return false;
+				for (XMVECTOR dir : { n, -n }) {
+					Vertex w = Support(a, b, dir);
+					if (std::abs(Dot(w.w - s.v[0].w, n)) > 1e-9f * nLen) { s.v[s.count++] = w; break; }
+				}
+				if (s.count < 4) return false;
+			}
+			return true;
+		}
+
+		/**
+		 * @struct	Face
+		 * @brief	EPA ̑ʑ̖̂ʁi@͌_Oj
+		 */
+		struct Face
+		{
+			int i[3];
+			XMVECTOR normal;
+			float dist;		// _ʂ܂ł̋
+		};
+
+		Face MakeFace(const Vertex* verts, int i0, int i1, int i2)
+		{
+			Face f = { { i0, i1, i2 }, XMVectorZero(), FLT_MAX };
+			XMVECTOR n = XMVector3Cross(verts[i1].w - verts[i0].w, verts[i2].w - verts[i0].w);
+			float len = XMVectorGetX(XMVector3Length(n));
+			if (len > 1e-12f) {
+				f.normal = n / len;
+				f.dist = Dot(f.normal, verts[i0].w);
+			}
+			return f;
+		}
+
+		// cm̂߂荞݁iA - B ̋EŌ_Ɉԋ߂ʁj
+		bool Epa(const Shape& a, const Shape& b, const Simplex& s, XMVECTOR& outNormal, float& outDepth)
+		{
+			Vertex verts[EpaMaxVertices];
+			Face faces[EpaMaxFaces];
+			int edges[EpaMaxFaces * 3][2];
+			int vertCount = 4, faceCount = 0;
+			for (int i = 0; i < 4; ++i) verts[i] = s.v[i];
+
+			// lʑ̖̂ʂOɂ낦
+			static const int tetra[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+			for (const auto& t : tetra) {
+				Face f = MakeFace(verts, t[0], t[1], t[2]);
+				if (Dot(XMVector3Cross(verts[t[1]].w - verts[t[0]].w, verts[t[2]].w - verts[t[0]].w), verts[t[3]].w - verts[t[0]].w) > 0.0f) {
+					f = MakeFace(verts, t[0], t[2], t[1]);
+				}
+				faces[faceCount++] = f;
+			}
+
+			int closest = 0;
+			for (int iter = 0; ; ++iter) {
+				closest = 0;
+				for (int i = 1; i < faceCount; ++i) {
+					if (faces[i].dist < faces[closest].dist) closest = i;
+				}
+				const Face best = faces[closest];
+				if (best.dist == FLT_MAX) return false;
+				if (iter >= EpaMaxIterations || vertCount >= EpaMaxVertices) break;
+
+				Vertex w = Support(a, b, best.normal);
+				if (Dot(w.w, best.normal) - best.dist < EpaTolerance) break;
+
+				// V_猩ʂOẢinjƐV_Ŗʂ𒣂
+				bool visible[EpaMaxFaces];
+				int edgeCount = 0, kept = 0;
+				for (int i = 0; i < faceCount; ++i) {
+					const Face& f = faces[i];
+					visible[i] = f.dist != FLT_MAX && Dot(f.normal, w.w - verts[f.i[0]].w) > 0.0f;
+					if (!visible[i]) { ++kept; continue; }
+
+					for (int e = 0; e < 3; ++e) {
+						int p = f.i[e], q = f.i[(e + 1) % 3];
+						// t̕ӂɂ΁A̖ʂÔŉł͂Ȃ
+						int found = -1;
+						for (int j = 0; j < edgeCount; ++j) {
+							if (edges[j][0] == q && edges[j][1] == p) { found = j; break; }
+						}
+						if (found >= 0) {
+							edges[found][0] = edges[edgeCount - 1][0];
+							edges[found][1] = edges[edgeCount - 1][1];
+							--edgeCount;
+						}
+						else {
+							edges[edgeCount][0] = p;
+							edges[edgeCount][1] = q;
+							++edgeCount;
+						}
+					}
+				}
+				// l덷ŌʂEʂ肫Ȃ́Äԋ߂ʂőł؂
+				if (kept == faceCount || kept + edgeCount > EpaMaxFaces) break;
+
+				const int k = vertCount;
+				verts[vertCount++] = w;
+				kept = 0;
+				for (int i = 0; i < faceCount; ++i) {
+					if (!visible[i]) faces[kept++] = faces[i];
+				}
+				faceCount = kept;
+				for (int j = 0; j < edgeCount; ++j) faces[faceCount++] = MakeFace(verts, edges[j][0], edges[j][1], k);
+			}
+
+			// ł؂A̎_ňԋ߂ʂԂ
+			closest = 0;
+			for (int i = 1; i < faceCount; ++i) {
+				if (faces[i].dist < faces[closest].dist) closest = i;
+			}
+			if (faces[closest].dist == FLT_MAX) return false;
+			outNormal = faces[closest].normal;
+			outDepth = std::max(0.0f, faces[closest].dist);
+			return true;
+		}
+
+		void StoreCache(SimplexCache* cache, const Simplex& s, int iterations)
+		{
+			if (!cache) return;
+			cache->count = (uint8_t)s.count;
+			cache->iterations = (uint8_t)iterations;
+			for (int i = 0; i < s.count; ++i) XMStoreFloat3(&cache->directions[i], s.v[i].dir);
+		}
+	}
+
+	bool UsesGJK(ColliderType a, ColliderType b)
+	{
+		// gFƁiEEJvZjAmAJvZm
+		// bV͎Op`Ƃɔ肷iCollisionSystem::CheckMeshĵŁAgƂĂ̒P͎̂Ȃ
+		if (a == ColliderType::Mesh || b == ColliderType::Mesh) return false;
+		auto closedForm = [](ColliderType x, ColliderType y) {
+			return (x == ColliderType::Sphere && y != ColliderType::Cylinder) || (x == y && x != ColliderType::Cylinder);
+			};
+		return !closedForm(a, b) && !closedForm(b, a);
+	}
+
+	XMVECTOR SupportCore(const CollisionProxy& shape, FXMVECTOR direction)
+	{
+		switch (shape.type) {
+		case ColliderType::Sphere:
+			return XMLoadFloat3(&shape.sphere.center);
+
+		case ColliderType::Box:
+		{
+			const OBB& box = shape.obb;
+			XMVECTOR p = XMLoadFloat3(&box.center);
+			const float extents[3] = { box.extents.x, box.extents.y, box.extents.z };
+			for (int i = 0; i < 3; ++i) {
+				XMVECTOR axis = XMLoadFloat3(&box.axes[i]);
+				p += axis * (Dot(axis, direction) >= 0.0f ? extents[i] : -extents[i]);
+			}
+			return p;
+		}
+
+		case ColliderType::Capsule:
+		{
+			XMVECTOR start = XMLoadFloat3(&shape.capsule.start);
+			XMVECTOR end = XMLoadFloat3(&shape.capsule.end);
+			return Dot(end - start, direction) >= 0.0f ? end : start;
+		}
+
+		case ColliderType::Cylinder:
+		{
+			// ͏㉺̖ʁAɐȕ͉̉~
+			const Cylinder& cyl = shape.cylinder;
+			XMVECTOR axis = XMLoadFloat3(&cyl.axis);
+			float along = Dot(axis, direction);
+			XMVECTOR p = XMLoadFloat3(&cyl.center) + axis * (along >= 0.0f ? cyl.height * 0.5f : -cyl.height * 0.5f);
+			XMVECTOR radial = direction - axis * along;
+			float radialSq = Dot(radial, radial);
+			if (radialSq > 1e-10f * Dot(direction, direction)) p += radial * (cyl.radius / std::sqrt(radialSq));
+			return p;
+		}
+
+		case ColliderType::Mesh:
+			break;	// Op`Ƃɔ肷iCollisionSystem::CheckMeshj
+		}
+		return XMVectorZero();
+	}
+
+	float CoreRadius(const CollisionProxy& shape)
+	{
+		switch (shape.type) {
+		case ColliderType::Sphere: return shape.sphere.radius;
+		case ColliderType::Capsule: return shape.capsule.radius;
+		default: return 0.0f;
+		}
+	}
+
+	namespace
+	{
+		// a, b ̒Sm̌BOp`܂ގ͖ʂ̖@𑊎̑֌́ia -> bj
+		XMVECTOR FallbackNormal(const Shape& a, const Shape& b)
+		{
+			XMVECTOR between = Center(b) - Center(a);
+			const Shape* triangle = !a.proxy ? &a : (!b.proxy ? &b : nullptr);
+			if (triangle) {
+				XMVECTOR n = XMVector3Normalize(XMVector3Cross(triangle->triangle[1] - triangle->triangle[0], triangle->triangle[2] - triangle->triangle[0]));
+				return Dot(n, between) < 0.0f ? -n : n;
+			}
+			return Dot(between, between) > 1e-12f ? XMVector3Normalize(between) : XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+		}
+
+		bool Collide(const Shape& a, const Shape& b, Contact& outContact, SimplexCache* cache)
+		{
+			const float margin = RadiusOf(a) + RadiusOf(b);
+
+			// --- 1. O̒P̂̈ʒuō蒼iΒSm̌j ---
+			Simplex s;
+			if (cache) {
+				for (int i = 0; i < cache->count; ++i) s.Add(Support(a, b, XMLoadFloat3(&cache->directions[i])));
+			}
+			if (s.count == 0) {
+				XMVECTOR dir = Center(b) - Center(a);
+				if (Dot(dir, dir) < 1e-12f) dir = XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+				s.Add(Support(a, b, dir));
+			}
+
+			// --- 2. GJKicm̋Ba藣Ăƕ_őł؂j ---
+			XMVECTOR v = XMVectorZero();
+			float vv = 0.0f;
+			bool overlap = false;
+			int iterations = 0;
+			for (;;) {
+				v = Closest(s, overlap);
+				if (overlap) break;
+				vv = Dot(v, v);
+				if (vv < 1e-12f) { overlap = true; break; }
+				if (iterations >= MaxIterations) break;
+
+				Vertex w = Support(a, b, -v);
+				++iterations;
+
+				// A - B  v Ƃ̓ς vw ȏ̑ɂ̂ŁA vw / |v| ȏ
+				float vw = Dot(v, w.w);
+				if (vw > 0.0f && vw * vw > margin * margin * vv) {
+					StoreCache(cache, s, iterations);
+					return false;
+				}
+				//  |v| Ɖ vw / |v| ̍F (vv - vw) / |v|
+				float gap = vv - vw;
+				if (gap <= RelativeTolerance * vv || gap * gap <= DistanceTolerance * DistanceTolerance * vv) break;
+				if (!s.Add(w)) break;
+			}
+
+			// --- 3. cĂFƔa̘a ---
+			if (!overlap) {
+				StoreCache(cache, s, iterations);
+				float dist = std::sqrt(vv);
+				if (dist >= margin) return false;
+
+				XMStoreFloat3(&outContact.normal, -v / dist);
+				outContact.depth = margin - dist;
+				return true;
+			}
+
+			// --- 4. cdȂĂFEPA Őĉ߂荞݂߁Aa𑫂 ---
+			XMVECTOR normal;
+			float depth;
+			if (!BlowUp(a, b, s) || !Epa(a, b, s, normal, depth)) {
+				// ci̐ςjőʑ̂Ȃ́ASm̌iOp`Ȃʂ̌jŉo
+				normal = FallbackNormal(a, b);
+				depth = 0.0f;
+			}
+			StoreCache(cache, s, iterations);
+			XMStoreFloat3(&outContact.normal, normal);
+			outContact.depth = depth + margin;
+			return true;
+		}
+
+		//  vs Op`FSɈԋ߂Op`̓_
+		bool SphereTriangle(FXMVECTOR a, FXMVECTOR b, FXMVECTOR c, const Sphere& sphere, Contact& outContact)
+		{
+			XMVECTOR center = XMLoadFloat3(&sphere.center);
+			Simplex s;
+			s.v[0].w = a - center; s.v[1].w = b - center; s.v[2].w = c - center;
+			s.count = 3;
+			XMVECTOR closest = ClosestOnTriangle(s);
+			float distSq = Dot(closest, closest);
+			if (distSq >= sphere.radius * sphere.radius) return false;
+
+			float dist = std::sqrt(distSq);
+			XMVECTOR normal;
+			if (dist > 1e-6f) normal = -closest / dist;
+			else {
+				// Sʂ̏Fʂ̖@iǂ͌߂Ȃ̂ŕ\j
+				normal = XMVector3Normalize(XMVector3Cross(b - a, c - a));
+				dist = 0.0f;
+			}
+			XMStoreFloat3(&outContact.normal, normal);
+			outContact.depth = sphere.radius - dist;
+			return true;
+		}
+
+		//  vs Op`FSATiOp`̖@E3E̎ƎOp`̕ӂ̊O 9 {j
+		bool BoxTriangle(FXMVECTOR a, FXMVECTOR b, FXMVECTOR c, const OBB& box, Contact& outContact)
+		{
+			XMVECTOR center = XMLoadFloat3(&box.center);
+			const XMVECTOR v[3] = { a - center, b - center, c - center };
+			const XMVECTOR axes[3] = { XMLoadFloat3(&box.axes[0]), XMLoadFloat3(&box.axes[1]), XMLoadFloat3(&box.axes[2]) };
+			const float extents[3] = { box.extents.x, box.extents.y, box.extents.z };
+
+			float minDepth = FLT_MAX;
+			XMVECTOR normal = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+			// Ă falseBdȂĂ΁Aǂ։Δ邩̒ZL^
+			auto testAxis = [&](XMVECTOR axis) -> bool {
+				float lenSq = Dot(axis, axis);
+				if (lenSq < 1e-12f) return true;	// sŎׂꂽ
+				axis /= std::sqrt(lenSq);
+
+				float p0 = Dot(v[0], axis), p1 = Dot(v[1], axis), p2 = Dot(v[2], axis);
+				float triMin = std::min({ p0, p1, p2 }), triMax = std::max({ p0, p1, p2 });
+				float r = extents[0] * std::abs(Dot(axes[0], axis)) + extents[1] * std::abs(Dot(axes[1], axis)) + extents[2] * std::abs(Dot(axes[2], axis));
+				if (triMin >= r || triMax <= -r) return false;
+
+				float up = triMax + r, down = r - triMin;	//  +axis / -axis ɉĔ
+				float depth = std::min(up, down);
+				if (depth < minDepth) {
+					minDepth = depth;
+					normal = up <= down ? axis : -axis;
+				}
+				return true;
+				};
+
+			const XMVECTOR edges[3] = { v[1] - v[0], v[2] - v[1], v[0] - v[2] };
+			if (!testAxis(XMVector3Cross(edges[0], edges[1]))) return false;
+			for (const auto& axis : axes) if (!testAxis(axis)) return false;
+			for (const auto& axis : axes) {
+				for (const auto& edge : edges) if (!testAxis(XMVector3Cross(axis, edge))) return false;
+			}
+
+			XMStoreFloat3(&outContact.normal, normal);
+			outContact.depth = minDepth;
+			return true;
+		}
+	}
+
+	bool CollideGJK(const CollisionProxy& a, const CollisionProxy& b, Contact& outContact, SimplexCache* cache)
+	{
+		return Collide(MakeShape(a), MakeShape(b), outContact, cache);
+	}
+
+	bool CollideTriangle(FXMVECTOR a, FXMVECTOR b, FXMVECTOR c, const CollisionProxy& shape, Contact& outContact)
+	{
+		// n`̏ňԑƔ͕iʂ GJK / EPA Ɠj
+		if (shape.type == ColliderType::Sphere) return SphereTriangle(a, b, c, shape.sphere, outContact);
+		if (shape.type == ColliderType::Box) return BoxTriangle(a, b, c, shape.obb, outContact);
+
+		Shape triangle;
+		triangle.proxy = nullptr;
+		triangle.triangle[0] = a;
+		triangle.triangle[1] = b;
+		triangle.triangle[2] = c;
+		return Collide(triangle, MakeShape(shape), outContact, nullptr);
+	}
+}
@@ -0,0 +1,80 @@
+/*****************************************************************//**
+ * @file	GJK.h
+ * @brief	T|[g֐ɂʌ`󓯎m̔iGJK ̋ + EPA ̂߂荞݁j
+ *
+ * @details
+ * `󂲂ƂɁuɈԉ_iT|[g_jvԂ֐pӂA
+ * ǂ̑gݍ킹 GJK / EPA Ŕ肵܂i`𑝂₵Ăgݍ킹̐֐ȂĂ悢jB
+ * ƃJvŹu_ / icj+ avƂĈAcm̋甼a
+ * ߂荞݂߂̂ŁAۂ͋ߎȂŔł܂B
+ * cmdȂĂ鎞 EPA Őĉ߂荞݂߁Aa𑫂܂B
+ *
+ * Ot[̒ṔiVvbNXjT|[g_߂ŊoĂiSimplexCachejA
+ * ̃t[͂̌n߂̂ŁAĂg 1, 2 ̔Ŏ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	EEJvZm͕im SATĵ̕ŁAg܂iUsesGJKjB
+ *			MeshCollider ̎Op` GJK / EPA Ŕ肵܂iCollideTrianglejB
+ *********************************************************************/
+
+#ifndef ___GJK_H___
+#define ___GJK_H___
+
+// ===== CN[h =====
+#include "Game/Systems/Physics/PhysicsSystem.h"
+#include <DirectXMath.h>
+#include <cstdint>
+
+namespace Physics
+{
+	struct CollisionProxy;
+
+	/**
+	 * @struct	SimplexCache
+	 * @brief	O̒Ṕi_ƂɃT|[g_߂j
+	 */
+	struct SimplexCache
+	{
+		DirectX::XMFLOAT3 directions[4];
+		uint8_t count = 0;			// 0 ȂO񂪖
+		uint8_t iterations = 0;		// O̔񐔁imFpj
+	};
+
+	/**
+	 * @struct	CachedSimplex
+	 * @brief	gƂ SimplexCacheikey  (a << 32) | bBa, b ͔肵j
+	 */
+	struct CachedSimplex
+	{
+		uint64_t key;
+		SimplexCache simplex;
+	};
+
+	// ̔֐AGJK / EPA Ŕ肷g
+	bool UsesGJK(ColliderType a, ColliderType b);
+
+	// ci͒SEJvZ͐EƉ~͂̂́j direction ̃T|[g_ƁAcɑa
+	DirectX::XMVECTOR SupportCore(const CollisionProxy& shape, DirectX::FXMVECTOR direction);
+	float CoreRadius(const CollisionProxy& shape);
+
+	/**
+	 * @brief	ʌ` a, b dȂĂΖ@ia -> bjƂ߂荞ݗʂ
+	 * @param	cache	O̒Ṕinullptr Ȃ璆Sm̌n߂jB̒P̂ŏ㏑܂
+	 */
+	bool CollideGJK(const CollisionProxy& a, const CollisionProxy& b, Contact& outContact, SimplexCache* cache = nullptr);
+
+	// Op` (a, b, c)iʁj shape dȂĂΖ@iOp` -> shapejƂ߂荞ݗʂ
+	// Ɣ͕AȊO͎Op`𔼌a 0 ̓ʌ`Ƃ GJK / EPA Ŕ肵܂
+	bool CollideTriangle(DirectX::FXMVECTOR a, DirectX::FXMVECTOR b, DirectX::FXMVECTOR c, const CollisionProxy& shape, Contact& outContact);
+}
+
+#endif // !___GJK_H___
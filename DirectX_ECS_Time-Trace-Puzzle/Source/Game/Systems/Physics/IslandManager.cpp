@@ -0,0 +1,240 @@
+/*****************************************************************//**
+ * @file	IslandManager.cpp
+ * @brief	ڐGłȂ̂̓ƁAƂ̖ / ڊo
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/IslandManager.h"
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include <algorithm>
+
+namespace Physics
+{
+	namespace
+	{
+		bool IsSlow(const DirectX::XMFLOAT3& v, float threshold)
+		{
+			return v.x * v.x + v.y * v.y + v.z * v.z < threshold * threshold;
+		}
+
+		// Ă鑊NiNĂ DynamicEĂ Kinematicj
+		bool IsActive(Registry& registry, Entity e)
+		{
+			if (!registry.has<Rigidbody>(e)) return false;
+			const Rigidbody& rb = registry.get<Rigidbody>(e);
+			if (rb.type == BodyType::Dynamic) return !rb.isSleeping;
+			if (rb.type == BodyType::Kinematic) return !IsSlow(rb.velocity, IslandManager::SleepVelocity);
+			return false;
+		}
+
+		bool IsSleeping(Registry& registry, Entity e)
+		{
+			return registry.has<Rigidbody>(e) && registry.get<Rigidbody>(e).isSleeping;
+		}
+	}
+
+	void IslandManager::WakeTouched(Registry& registry, const std::vector<CollisionProxy>& proxies, const std::vector<Contact>& contacts, float dt)
+	{
+		// --- 1. ONꂽ́ix^ꂽEꂽj͓̑SN ---
+		for (const auto& proxy : proxies) {
+			uint32_t island = GetIsland(proxy.entity);
+			if (island != InvalidId && !IsSleeping(registry, proxy.entity)) WakeIsland(registry, island);
+		}
+
+		// --- 2. NĂ̂ɐGꂽN ---
+		for (const auto& contact : contacts) {
+			bool sleepA = IsSleeping(registry, contact.a);
+			bool sleepB = IsSleeping(registry, contact.b);
+			if (sleepA == sleepB) continue;
+
+			Entity sleeper = sleepA ? contact.a : contact.b;
+			Entity other = sleepA ? contact.b : contact.a;
+			if (IsActive(registry, other)) Wake(registry, sleeper);
+		}
+
+		// --- 3. ϕ̌ɋN̂́ÃXebv̑x̐ϕς܂ ---
+		for (Entity e : m_woken) {
+			if (registry.has<Rigidbody>(e)) PhysicsSystem::IntegrateVelocity(registry.get<Rigidbody>(e), dt);
+		}
+		m_woken.clear();
+	}
+
+	void IslandManager::UpdateSleep(Registry& registry, const std::vector<CollisionProxy>& proxies, const std::vector<Contact>& contacts, float dt)
+	{
+		m_awakeIslandCount = 0;
+		if (!m_enabled) return;
+
+		// --- 1. NĂ Dynamic ̍̂ߓ_ɂA~܂Ă鎞Ԃ𐔂 ---
+		m_nodeEntities.clear();
+		m_parent.clear();
+		m_islandTime.clear();
+		for (const auto& proxy : proxies) {
+			Entity e = proxy.entity;
+			if (proxy.bodyType != BodyType::Dynamic || !registry.has<Rigidbody>(e)) continue;
+			Rigidbody& rb = registry.get<Rigidbody>(e);
+			if (rb.type != BodyType::Dynamic || rb.isSleeping) continue;
+
+			rb.sleepTime = IsSlow(rb.velocity, SleepVelocity) ? rb.sleepTime + dt : 0.0f;
+
+			if (e >= m_nodeOf.size()) m_nodeOf.resize((size_t)e + 1, InvalidId);
+			m_nodeOf[e] = (uint32_t)m_nodeEntities.size();
+			m_parent.push_back((uint32_t)m_nodeEntities.size());
+			m_islandTime.push_back(rb.sleepTime);
+			m_nodeEntities.push_back(e);
+		}
+
+		auto nodeOf = [this](Entity e) { return e < m_nodeOf.size() ? m_nodeOf[e] : InvalidId; };
+
+		// --- 2. ڐGłȂiĂ Kinematic ɐGĂ鍄͖̂点Ȃj ---
+		for (const auto& contact : contacts) {
+			uint32_t a = nodeOf(contact.a);
+			uint32_t b = nodeOf(contact.b);
+			if (a != InvalidId && b != InvalidId) {
+				Union(a, b);
+			}
+			else if (a != InvalidId || b != InvalidId) {
+				uint32_t node = (a != InvalidId) ? a : b;
+				Entity other = (a != InvalidId) ? contact.b : contact.a;
+				if (IsActive(registry, other)) m_islandTime[node] = 0.0f;
+			}
+		}
+
+		// --- 3. ijƂɈԒZԂW߂ ---
+		const uint32_t nodeCount = (uint32_t)m_nodeEntities.size();
+		for (uint32_t i = 0; i < nodeCount; ++i) {
+			uint32_t root = Find(i);
+			m_islandTime[root] = std::min(m_islandTime[root], m_islandTime[i]);
+		}
+
+		// --- 4. S TimeToSleep 𒴂ɔԍ蓖Ă ---
+		m_rootIsland.assign(nodeCount, InvalidId);
+		for (uint32_t i = 0; i < nodeCount; ++i) {
+			if (m_parent[i] != i) continue;
+			if (m_islandTime[i] < TimeToSleep) { ++m_awakeIslandCount; continue; }
+
+			if (!m_freeIds.empty()) { m_rootIsland[i] = m_freeIds.back(); m_freeIds.pop_back(); }
+			else { m_rootIsland[i] = (uint32_t)m_sleeping.size(); m_sleeping.emplace_back(); }
+		}
+
+		// --- 5. 点ix 0 ɂāA̓oĂj ---
+		for (uint32_t i = 0; i < nodeCount; ++i) {
+			Entity e = m_nodeEntities[i];
+			m_nodeOf[e] = InvalidId;
+
+			uint32_t island = m_rootIsland[Find(i)];
+			if (island == InvalidId) continue;
+
+			Rigidbody& rb = registry.get<Rigidbody>(e);
+			rb.isSleeping = true;
+			rb.velocity = { 0.0f, 0.0f, 0.0f };
+
+			if (e >= m_islandOf.size()) {
+				m_islandOf.resize((size_t)e + 1, InvalidId);
+				m_versionOf.resize((size_t)e + 1, 0);
+			}
+			m_islandOf[e] = island;
+			m_versionOf[e] = registry.version<Rigidbody>(e);
+			m_sleeping[island].push_back(e);
+			++m_sleepingBodyCount;
+		}
+	}
+
+	void IslandManager::Wake(Registry& registry, Entity entity)
+	{
+		uint32_t island = GetIsland(entity);
+		if (island != InvalidId) {
+			WakeIsland(registry, island);
+		}
+		else if (registry.has<Rigidbody>(entity)) {
+			WakeBody(registry.get<Rigidbody>(entity), entity);
+		}
+	}
+
+	void IslandManager::WakeBody(Rigidbody& rb, Entity entity)
+	{
+		if (rb.isSleeping) m_woken.push_back(entity);
+		rb.isSleeping = false;
+		rb.sleepTime = 0.0f;
+	}
+
+	void IslandManager::WakeIsland(Registry& registry, uint32_t island)
+	{
+		auto& members = m_sleeping[island];
+		for (Entity e : members) {
+			if (e < m_islandOf.size() && m_islandOf[e] == island) m_islandOf[e] = InvalidId;
+			if (registry.has<Rigidbody>(e)) WakeBody(registry.get<Rigidbody>(e), e);
+		}
+		m_sleepingBodyCount -= members.size();
+		members.clear();
+		m_freeIds.push_back(island);
+	}
+
+	void IslandManager::WakeAll(Registry& registry)
+	{
+		for (uint32_t i = 0; i < (uint32_t)m_sleeping.size(); ++i) {
+			if (!m_sleeping[i].empty()) WakeIsland(registry, i);
+		}
+	}
+
+	void IslandManager::RemoveDestroyed(Registry& registry)
+	{
+		for (uint32_t island = 0; island < (uint32_t)m_sleeping.size(); ++island) {
+			auto& members = m_sleeping[island];
+			if (members.empty()) continue;
+
+			auto removed = std::remove_if(members.begin(), members.end(), [&](Entity e) {
+				// ԍŕtꂽ Rigidbody ́ÂƂ͕ʂ̂
+				if (registry.has<Rigidbody>(e) && registry.version<Rigidbody>(e) == m_versionOf[e]) return false;
+				if (m_islandOf[e] == island) m_islandOf[e] = InvalidId;
+				return true;
+				});
+			m_sleepingBodyCount -= (size_t)std::distance(removed, members.end());
+			members.erase(removed, members.end());
+
+			// SȂȂ̔ԍ͎g
+			if (members.empty()) m_freeIds.push_back(island);
+		}
+	}
+
+	void IslandManager::SetEnabled(Registry& registry, bool enable)
+	{
+		m_enabled = enable;
+		if (!enable) WakeAll(registry);
+	}
+
+	uint32_t IslandManager::Find(uint32_t node)
+	{
+		// oH𔼕ɏk߂Ȃ獪T
+		while (m_parent[node] != node) {
+			m_parent[node] = m_parent[m_parent[node]];
+			node = m_parent[node];
+		}
+		return node;
+	}
+
+	void IslandManager::Union(uint32_t a, uint32_t b)
+	{
+		a = Find(a);
+		b = Find(b);
+		if (a == b) return;
+		// ԍɂiʂڐG̏ԂɂȂj
+		if (a < b) m_parent[b] = a;
+		else m_parent[a] = b;
+	}
+}
@@ -0,0 +1,121 @@
+/*****************************************************************//**
+ * @file	IslandManager.h
+ * @brief	ڐGłȂ̂̓ƁAƂ̖ / ڊo
+ *
+ * @details
+ * NĂ Dynamic ̍̂AڐGłȂ̓ḿuvɂ܂Ƃ߂܂iUnion-FindjB
+ * x臒l菬Ԃ̂ƂɐȂS TimeToSleep 𒴂瓇Ɩ点܂B
+ * ̂͐ϕEvLV̍蒼Ei[tF[YE\o[ÔŁA
+ * ͂قƂǏ܂B
+ * NĂ鍄̂⓮Ă Kinematic GꂽAO瑬x^ꂽA
+ * ꂽ́A̓̑S܂Ƃ߂ċN܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	Static / KinematicERigidbody Ȃ͓̂ɓ܂iƓȂȂjB
+ *********************************************************************/
+
+#ifndef ___ISLAND_MANAGER_H___
+#define ___ISLAND_MANAGER_H___
+
+// ===== CN[h =====
+#include "Engine/ECS/ECS.h"
+#include "Game/Components/Components.h"
+#include "Game/Systems/Physics/PhysicsSystem.h"
+#include <vector>
+#include <cstdint>
+
+namespace Physics
+{
+	struct CollisionProxy;
+
+	/**
+	 * @class	IslandManager
+	 * @brief	̑gݗĂƁA / ڊo߂̊Ǘ
+	 */
+	class IslandManager
+	{
+	public:
+		// ̑ [m/s] x΁u~܂Ăv
+		static constexpr float SleepVelocity = 0.05f;
+		// ̑S̎ [s] ~܂Ă疰点
+		static constexpr float TimeToSleep = 0.5f;
+
+		// CollisionSystem::Step ̍ŏɌĂԁĩXebvŋN̂̋L^ɂj
+		void BeginStep() { m_woken.clear(); }
+
+		/**
+		 * @brief	\o[̑OɁAĂ铇N
+		 * @details	ONꂽ́iPhysicsSystem xċNj̓ƁA
+		 *			NĂ鍄́EĂ Kinematic ƐڐGN܂B
+		 *			̃XebviBeginStep ȍ~jɋN̂ PhysicsSystem ̐ϕ̌ɋN̂ŁA
+		 *			΂ꂽx̐ϕid́ECRjōς܂ANĂ̂ƓԂŃ\o[ɓn܂B
+		 */
+		void WakeTouched(Registry& registry, const std::vector<CollisionProxy>& proxies, const std::vector<Contact>& contacts, float dt);
+
+		/**
+		 * @brief	\o[̌ɁA~܂Ă鎞Ԃ𐔂ēƂɖ点
+		 */
+		void UpdateSleep(Registry& registry, const std::vector<CollisionProxy>& proxies, const std::vector<Contact>& contacts, float dt);
+
+		// entity Ă΁A̓ƋN
+		void Wake(Registry& registry, Entity entity);
+		void WakeAll(Registry& registry);
+
+		/**
+		 * @brief	Rigidbody ȂiEntity ̍폜EOjĂ鍄̂𓇂O
+		 * @details	ԍō蒼ꂽ Entity AO̓̔ԍ▰pȂ悤ɂ܂B
+		 *			 Rigidbody ̔ŁiRegistry::versionjƔׂ̂ŁAԍɐV Rigidbody tĂĂO܂B
+		 *			Rigidbody ̒ǉE폜irevision ςjɌĂłB
+		 */
+		void RemoveDestroyed(Registry& registry);
+
+		// ɂƑSNAȌ͖点Ȃ
+		void SetEnabled(Registry& registry, bool enable);
+		bool IsEnabled() const { return m_enabled; }
+
+		// O UpdateSleep ŐNĂ铇̐ / Ă铇Ê̐imFpj
+		size_t GetAwakeIslandCount() const { return m_awakeIslandCount; }
+		size_t GetSleepingIslandCount() const { return m_sleeping.size() - m_freeIds.size(); }
+		size_t GetSleepingBodyCount() const { return m_sleepingBodyCount; }
+
+	private:
+		// Ă铇̔ԍiNĂ InvalidIdj
+		uint32_t GetIsland(Entity entity) const { return entity < m_islandOf.size() ? m_islandOf[entity] : InvalidId; }
+		void WakeIsland(Registry& registry, uint32_t island);
+		void WakeBody(Rigidbody& rb, Entity entity);
+
+		uint32_t Find(uint32_t node);
+		void Union(uint32_t a, uint32_t b);
+
+		static constexpr uint32_t InvalidId = 0xFFFFFFFFu;
+
+		bool m_enabled = true;
+
+		// Ă铇iԍňB󂢂ԍ͎g񂷁j
+		std::vector<uint32_t> m_islandOf;			// Entity -> ̔ԍ
+		std::vector<uint64_t> m_versionOf;			// Entity ->  Rigidbody ̔
+		std::vector<std::vector<Entity>> m_sleeping;
+		std::vector<uint32_t> m_freeIds;
+		size_t m_sleepingBodyCount = 0;
+		size_t m_awakeIslandCount = 0;
+		std::vector<Entity> m_woken;				// ̃XebvɋN
+
+		// Union-FindiNĂ Dynamic ̍̂ߓ_Bt[蒼j
+		std::vector<uint32_t> m_nodeOf;				// Entity -> ߓ_ԍ
+		std::vector<Entity> m_nodeEntities;
+		std::vector<uint32_t> m_parent;
+		std::vector<float> m_islandTime;			// Ƃ́uԒZ~܂Ă鎞ԁv
+		std::vector<uint32_t> m_rootIsland;			// Ƃ̖点铇̔ԍiN܂܂Ȃ InvalidIdj
+	};
+}
+
+#endif // !___ISLAND_MANAGER_H___
@@ -0,0 +1,93 @@
+/*****************************************************************//**
+ * @file	LayerMatrix.h
+ * @brief	蔻背C[m̑gݍ킹\ivWFNgʁj
+ *
+ * @details
+ * C[ i ̍s j rbgڂĂ΁AC[ i  j ͔肵܂iɑΏ́jB
+ * Collider::mask ƍ킹āAu[htF[Y̌yAi[tF[Y̑OɐU藎Ƃ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___LAYER_MATRIX_H___
+#define ___LAYER_MATRIX_H___
+
+// ===== CN[h =====
+#include "Game/Components/Components.h"
+#include <cstdint>
+
+namespace Physics
+{
+	/**
+	 * @class	LayerMatrix
+	 * @brief	C[̑gݍ킹\
+	 */
+	class LayerMatrix
+	{
+	public:
+		static constexpr int MaxLayers = 32;
+
+		static LayerMatrix& Instance()
+		{
+			static LayerMatrix instance;
+			return instance;
+		}
+
+		// ŏ̏Ԃɖ߂
+		// cEopEjЁEUI ݂͌ɔ肵ȂiUI ̓CLXgpȂ̂ŉƂ肵Ȃj
+		void Reset()
+		{
+			for (auto& row : m_rows) row = 0xFFFFFFFFu;
+
+			const CollisionLayer passive[] = { CollisionLayer::Ghost, CollisionLayer::Sensor, CollisionLayer::Debris, CollisionLayer::UI };
+			for (CollisionLayer a : passive) {
+				for (CollisionLayer b : passive) {
+					if (a != b) SetCollision(a, b, false);
+				}
+			}
+			for (int i = 0; i < MaxLayers; ++i) SetCollision(CollisionLayer::UI, (CollisionLayer)i, false);
+		}
+
+		void SetCollision(CollisionLayer a, CollisionLayer b, bool enable)
+		{
+			if (enable) {
+				m_rows[(int)a] |= LayerBit(b);
+				m_rows[(int)b] |= LayerBit(a);
+			}
+			else {
+				m_rows[(int)a] &= ~LayerBit(b);
+				m_rows[(int)b] &= ~LayerBit(a);
+			}
+		}
+
+		bool CanCollide(CollisionLayer a, CollisionLayer b) const { return (m_rows[(int)a] & LayerBit(b)) != 0; }
+
+		// C[ a Ɣ肷郌C[̃rbg
+		uint32_t GetRow(CollisionLayer a) const { return m_rows[(int)a]; }
+
+		// C[ifobO\pBO̖C[ "Layer"j
+		static const char* GetLayerName(CollisionLayer layer)
+		{
+			static const char* names[] = { "Default", "Player", "Ghost", "Sensor", "Debris", "UI" };
+			int i = (int)layer;
+			return i < (int)CollisionLayer::Count ? names[i] : "Layer";
+		}
+
+	private:
+		LayerMatrix() { Reset(); }
+
+		uint32_t m_rows[MaxLayers];
+	};
+}
+
+#endif // !___LAYER_MATRIX_H___
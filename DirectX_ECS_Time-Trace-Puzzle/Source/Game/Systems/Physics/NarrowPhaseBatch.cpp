@@ -0,0 +1,562 @@
+/*****************************************************************//**
+ * @file	NarrowPhaseBatch.cpp
+ * @brief	`̑gݍ킹Ƃɂ܂Ƃ߂Ĕ肷i[tF[YSIMDJ[l
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/NarrowPhaseBatch.h"
+#include "Game/Systems/Logic/TransformBatch.h"
+#include <cfloat>
+#include <algorithm>
+
+// x64 / SSE2Lx86 ̂SIMDoHrh
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NARROW_PHASE_BATCH_SIMD 1
+#include <immintrin.h>
+#else
+#define NARROW_PHASE_BATCH_SIMD 0
+#endif
+
+using namespace DirectX;
+using Physics::ShapePair;
+using Physics::Contact;
+
+namespace
+{
+#if NARROW_PHASE_BATCH_SIMD
+	// =================================================================
+	// [Ƃ̉Zbp[iJ[l{̂̓ev[gŋʉj
+	// =================================================================
+	struct LaneSSE
+	{
+		using V = __m128;
+		static constexpr size_t Width = 4;
+
+		static V Load(const float* p) { return _mm_load_ps(p); }
+		static void Store(float* p, V v) { _mm_store_ps(p, v); }
+		static V Set(float s) { return _mm_set1_ps(s); }
+		static V Add(V a, V b) { return _mm_add_ps(a, b); }
+		static V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+		static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+		static V Div(V a, V b) { return _mm_div_ps(a, b); }
+		static V Sqrt(V a) { return _mm_sqrt_ps(a); }
+		static V Abs(V a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		static V Neg(V a) { return _mm_xor_ps(_mm_set1_ps(-0.0f), a); }
+		static V And(V a, V b) { return _mm_and_ps(a, b); }
+		static V AndNot(V a, V b) { return _mm_andnot_ps(a, b); }	// ~a & b
+		static V Less(V a, V b) { return _mm_cmplt_ps(a, b); }
+		static V Greater(V a, V b) { return _mm_cmpgt_ps(a, b); }
+		static V NotLess(V a, V b) { return _mm_cmpnlt_ps(a, b); }
+		static V NotGreater(V a, V b) { return _mm_cmpngt_ps(a, b); }
+		static V NotGreaterEqual(V a, V b) { return _mm_cmpnge_ps(a, b); }
+		static V LessEqual(V a, V b) { return _mm_cmple_ps(a, b); }
+		static V NotEqual(V a, V b) { return _mm_cmpneq_ps(a, b); }
+		// mask ? a : b
+		static V Select(V mask, V a, V b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+		static int MoveMask(V a) { return _mm_movemask_ps(a); }
+		// c - a * biXMVector3Cross ƓADirectXMath FMAgݒȂZj
+		static V NegMulAdd(V a, V b, V c)
+		{
+#if defined(_XM_FMA3_INTRINSICS_)
+			return _mm_fnmadd_ps(a, b, c);
+#else
+			return _mm_sub_ps(c, _mm_mul_ps(a, b));
+#endif
+		}
+	};
+
+	struct LaneAVX2
+	{
+		using V = __m256;
+		static constexpr size_t Width = 8;
+
+		static V Load(const float* p) { return _mm256_load_ps(p); }
+		static void Store(float* p, V v) { _mm256_store_ps(p, v); }
+		static V Set(float s) { return _mm256_set1_ps(s); }
+		static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+		static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+		static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+		static V Div(V a, V b) { return _mm256_div_ps(a, b); }
+		static V Sqrt(V a) { return _mm256_sqrt_ps(a); }
+		static V Abs(V a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		static V Neg(V a) { return _mm256_xor_ps(_mm256_set1_ps(-0.0f), a); }
+		static V And(V a, V b) { return _mm256_and_ps(a, b); }
+		static V AndNot(V a, V b) { return _mm256_andnot_ps(a, b); }	// ~a & b
+		static V Less(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static V Greater(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		static V NotLess(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_NLT_UQ); }
+		static V NotGreater(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_NGT_UQ); }
+		static V NotGreaterEqual(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_NGE_UQ); }
+		static V LessEqual(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		static V NotEqual(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+		// mask ? a : b
+		static V Select(V mask, V a, V b) { return _mm256_blendv_ps(b, a, mask); }
+		static int MoveMask(V a) { return _mm256_movemask_ps(a); }
+		// c - a * biXMVector3Cross ƓADirectXMath FMAgݒȂZj
+		static V NegMulAdd(V a, V b, V c)
+		{
+#if defined(_XM_FMA3_INTRINSICS_)
+			return _mm256_fnmadd_ps(a, b, c);
+#else
+			return _mm256_sub_ps(c, _mm256_mul_ps(a, b));
+#endif
+		}
+	};
+
+	/**
+	 * @brief	XMVector3Dot ƓԂ̓ ((x * x) + (y * y)) + (z * z)
+	 */
+	template<typename L>
+	typename L::V Dot(typename L::V ax, typename L::V ay, typename L::V az,
+		typename L::V bx, typename L::V by, typename L::V bz)
+	{
+		return L::Add(L::Add(L::Mul(ax, bx), L::Mul(ay, by)), L::Mul(az, bz));
+	}
+
+	/**
+	 * @brief	std::max(0.0f, std::min(1.0f, x)) ƓʁiNaN  1 ɂȂj
+	 */
+	template<typename L>
+	typename L::V Clamp01(typename L::V x)
+	{
+		typename L::V zero = L::Set(0.0f), one = L::Set(1.0f);
+		typename L::V m = L::Select(L::Less(x, one), x, one);
+		return L::Select(L::Less(zero, m), m, zero);
+	}
+
+	// 1yA̔茋ʂo
+	void Emit(const ShapePair& p, float nx, float ny, float nz, float depth, std::vector<Contact>& out)
+	{
+		Contact c;
+		c.a = p.a->entity;
+		c.b = p.b->entity;
+		c.normal = { nx, ny, nz };
+		c.depth = depth;
+		out.push_back(c);
+	}
+
+	// =================================================================
+	//  vs 
+	// =================================================================
+	template<typename L>
+	void SphereSphereBlock(const ShapePair* pairs, size_t n, std::vector<Contact>& out)
+	{
+		using V = typename L::V;
+		constexpr size_t W = L::Width;
+
+		// --- 1. W (AoS -> SoA)BȂ[͐擪̃yAŖ߂ ---
+		alignas(32) float in[8][W];	// A xyz r, B xyz r
+		for (size_t i = 0; i < W; ++i)
+		{
+			const ShapePair& p = pairs[i < n ? i : 0];
+			const Physics::Sphere& a = p.a->sphere;
+			const Physics::Sphere& b = p.b->sphere;
+			in[0][i] = a.center.x; in[1][i] = a.center.y; in[2][i] = a.center.z; in[3][i] = a.radius;
+			in[4][i] = b.center.x; in[5][i] = b.center.y; in[6][i] = b.center.z; in[7][i] = b.radius;
+		}
+
+		// --- 2. CheckSphereSphere Ɠ ---
+		V dx = L::Sub(L::Load(in[4]), L::Load(in[0]));
+		V dy = L::Sub(L::Load(in[5]), L::Load(in[1]));
+		V dz = L::Sub(L::Load(in[6]), L::Load(in[2]));
+		V distSq = Dot<L>(dx, dy, dz, dx, dy, dz);
+		V rSum = L::Add(L::Load(in[3]), L::Load(in[7]));
+
+		int hit = L::MoveMask(L::NotGreaterEqual(distSq, L::Mul(rSum, rSum))) & ((1 << n) - 1);
+		if (hit == 0) return;
+
+		V dist = L::Sqrt(distSq);
+		V overlapped = L::Less(dist, L::Set(1e-4f));	// SɏdȂ
+		dist = L::Select(overlapped, L::Set(0.0f), dist);
+
+		alignas(32) float out4[4][W];
+		L::Store(out4[0], L::Select(overlapped, L::Set(0.0f), L::Div(dx, dist)));
+		L::Store(out4[1], L::Select(overlapped, L::Set(1.0f), L::Div(dy, dist)));
+		L::Store(out4[2], L::Select(overlapped, L::Set(0.0f), L::Div(dz, dist)));
+		L::Store(out4[3], L::Sub(rSum, dist));
+
+		// --- 3. [o ---
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (hit & (1 << i)) Emit(pairs[i], out4[0][i], out4[1][i], out4[2][i], out4[3][i], out);
+		}
+	}
+
+	// =================================================================
+	//  vs 
+	// =================================================================
+	template<typename L>
+	void SphereOBBBlock(const ShapePair* pairs, size_t n, std::vector<Contact>& out, std::vector<ShapePair>& deep)
+	{
+		using V = typename L::V;
+		constexpr size_t W = L::Width;
+
+		// --- 1. W (AoS -> SoA) ---
+		alignas(32) float in[19][W];	//  xyz r, ̒S xyz, 傫 xyz,  3x3
+		int flipped = 0;				//  a ̃yAi@𔽓]j
+		for (size_t i = 0; i < W; ++i)
+		{
+			const ShapePair& p = pairs[i < n ? i : 0];
+			bool boxFirst = (p.a->type == ColliderType::Box);
+			if (boxFirst && i < n) flipped |= (1 << i);
+
+			const Physics::Sphere& s = boxFirst ? p.b->sphere : p.a->sphere;
+			const Physics::OBB& b = boxFirst ? p.a->obb : p.b->obb;
+			in[0][i] = s.center.x; in[1][i] = s.center.y; in[2][i] = s.center.z; in[3][i] = s.radius;
+			in[4][i] = b.center.x; in[5][i] = b.center.y; in[6][i] = b.center.z;
+			in[7][i] = b.extents.x; in[8][i] = b.extents.y; in[9][i] = b.extents.z;
+			for (int k = 0; k < 3; ++k)
+			{
+				in[10 + k * 3][i] = b.axes[k].x;
+				in[11 + k * 3][i] = b.axes[k].y;
+				in[12 + k * 3][i] = b.axes[k].z;
+			}
+		}
+
+		// --- 2. ̏̍ŋߐړ_iClosestPointOnOBB Ɠj ---
+		V px = L::Load(in[0]), py = L::Load(in[1]), pz = L::Load(in[2]);
+		V cx = L::Load(in[4]), cy = L::Load(in[5]), cz = L::Load(in[6]);
+		V dx = L::Sub(px, cx), dy = L::Sub(py, cy), dz = L::Sub(pz, cz);
+		V qx = cx, qy = cy, qz = cz;
+		for (int k = 0; k < 3; ++k)
+		{
+			V ax = L::Load(in[10 + k * 3]), ay = L::Load(in[11 + k * 3]), az = L::Load(in[12 + k * 3]);
+			V extent = L::Load(in[7 + k]);
+			V dist = Dot<L>(dx, dy, dz, ax, ay, az);
+			dist = L::Select(L::Greater(dist, extent), extent, dist);
+			V negExtent = L::Neg(extent);
+			dist = L::Select(L::Less(dist, negExtent), negExtent, dist);
+
+			qx = L::Add(qx, L::Mul(ax, dist));
+			qy = L::Add(qy, L::Mul(ay, dist));
+			qz = L::Add(qz, L::Mul(az, dist));
+		}
+
+		// --- 3. CheckSphereOBB Ɠ ---
+		V vx = L::Sub(qx, px), vy = L::Sub(qy, py), vz = L::Sub(qz, pz);
+		V distSq = Dot<L>(vx, vy, vz, vx, vy, vz);
+		V radius = L::Load(in[3]);
+
+		int valid = (1 << n) - 1;
+		int hit = L::MoveMask(L::NotGreater(distSq, L::Mul(radius, radius))) & valid;
+		if (hit == 0) return;
+
+		V dist = L::Sqrt(distSq);
+		int inside = L::MoveMask(L::Less(dist, L::Set(1e-4f))) & hit;
+
+		//  -> 
+		alignas(32) float out4[4][W];
+		L::Store(out4[0], L::Div(vx, dist));
+		L::Store(out4[1], L::Div(vy, dist));
+		L::Store(out4[2], L::Div(vz, dist));
+		L::Store(out4[3], L::Sub(radius, dist));
+
+		// --- 4. oiS̒ɂ̂̓XJ[ɉ񂷁j ---
+		for (size_t i = 0; i < n; ++i)
+		{
+			int bit = 1 << i;
+			if (!(hit & bit)) continue;
+			if (inside & bit) { deep.push_back(pairs[i]); continue; }
+
+			float nx = out4[0][i], ny = out4[1][i], nz = out4[2][i];
+			if (flipped & bit) { nx *= -1; ny *= -1; nz *= -1; }
+			Emit(pairs[i], nx, ny, nz, out4[3][i], out);
+		}
+	}
+
+	// =================================================================
+	//  vs ij
+	// =================================================================
+	template<typename L>
+	void OBBOBBBlock(const ShapePair* pairs, size_t n, std::vector<Contact>& out)
+	{
+		using V = typename L::V;
+		constexpr size_t W = L::Width;
+
+		// --- 1. W (AoS -> SoA) ---
+		alignas(32) float in[30][W];	// S xyz, 傫 xyz,  3x3  A, B ̏
+		for (size_t i = 0; i < W; ++i)
+		{
+			const ShapePair& p = pairs[i < n ? i : 0];
+			const Physics::OBB* boxes[2] = { &p.a->obb, &p.b->obb };
+			for (int s = 0; s < 2; ++s)
+			{
+				const Physics::OBB& b = *boxes[s];
+				int base = s * 15;
+				in[base + 0][i] = b.center.x; in[base + 1][i] = b.center.y; in[base + 2][i] = b.center.z;
+				in[base + 3][i] = b.extents.x; in[base + 4][i] = b.extents.y; in[base + 5][i] = b.extents.z;
+				for (int k = 0; k < 3; ++k)
+				{
+					in[base + 6 + k * 3][i] = b.axes[k].x;
+					in[base + 7 + k * 3][i] = b.axes[k].y;
+					in[base + 8 + k * 3][i] = b.axes[k].z;
+				}
+			}
+		}
+
+		V tx = L::Sub(L::Load(in[15]), L::Load(in[0]));
+		V ty = L::Sub(L::Load(in[16]), L::Load(in[1]));
+		V tz = L::Sub(L::Load(in[17]), L::Load(in[2]));
+
+		V extA[3], extB[3];
+		V axesA[3][3], axesB[3][3];
+		for (int k = 0; k < 3; ++k)
+		{
+			extA[k] = L::Load(in[3 + k]);
+			extB[k] = L::Load(in[18 + k]);
+			for (int c = 0; c < 3; ++c)
+			{
+				axesA[k][c] = L::Load(in[6 + k * 3 + c]);
+				axesB[k][c] = L::Load(in[21 + k * 3 + c]);
+			}
+		}
+
+		V zero = L::Set(0.0f);
+		V alive = L::NotLess(zero, zero);	// Srbg1i܂ĂȂj
+		V minOverlap = L::Set(FLT_MAX);
+		V mtvX = zero, mtvY = L::Set(1.0f), mtvZ = zero;
+		int valid = (1 << n) - 1;
+
+		// --- 2. CheckOBBOBB  TestAxis Ɠ ---
+		auto testAxis = [&](V ax, V ay, V az)
+			{
+				V lengthSq = Dot<L>(ax, ay, az, ax, ay, az);
+				V usable = L::NotLess(lengthSq, L::Set(1e-6f));	// sȂǂŎׂꂽꍇ͔΂
+
+				// XMVector3Normalizeiv / sqrt(̓)j
+				V length = L::Sqrt(lengthSq);
+				ax = L::Div(ax, length); ay = L::Div(ay, length); az = L::Div(az, length);
+
+				V rA = L::Mul(extA[0], L::Abs(Dot<L>(axesA[0][0], axesA[0][1], axesA[0][2], ax, ay, az)));
+				rA = L::Add(rA, L::Mul(extA[1], L::Abs(Dot<L>(axesA[1][0], axesA[1][1], axesA[1][2], ax, ay, az))));
+				rA = L::Add(rA, L::Mul(extA[2], L::Abs(Dot<L>(axesA[2][0], axesA[2][1], axesA[2][2], ax, ay, az))));
+
+				V rB = L::Mul(extB[0], L::Abs(Dot<L>(axesB[0][0], axesB[0][1], axesB[0][2], ax, ay, az)));
+				rB = L::Add(rB, L::Mul(extB[1], L::Abs(Dot<L>(axesB[1][0], axesB[1][1], axesB[1][2], ax, ay, az))));
+				rB = L::Add(rB, L::Mul(extB[2], L::Abs(Dot<L>(axesB[2][0], axesB[2][1], axesB[2][2], ax, ay, az))));
+
+				V along = Dot<L>(tx, ty, tz, ax, ay, az);
+				V overlap = L::Sub(L::Add(rA, rB), L::Abs(along));
+
+				// Ă
+				alive = L::AndNot(L::And(usable, L::Less(overlap, zero)), alive);
+
+				// ŏ̉oʂL^ǐ A -> B ɑj
+				V better = L::And(L::And(usable, alive), L::Less(overlap, minOverlap));
+				V reverse = L::Less(along, zero);
+				minOverlap = L::Select(better, overlap, minOverlap);
+				mtvX = L::Select(better, L::Select(reverse, L::Sub(zero, ax), ax), mtvX);
+				mtvY = L::Select(better, L::Select(reverse, L::Sub(zero, ay), ay), mtvY);
+				mtvZ = L::Select(better, L::Select(reverse, L::Sub(zero, az), az), mtvZ);
+
+				// S[ŕł؂
+				return (L::MoveMask(alive) & valid) != 0;
+			};
+
+		// 1. A̖ʖ@ (3) / 2. B̖ʖ@ (3)
+		for (int i = 0; i < 3; ++i) if (!testAxis(axesA[i][0], axesA[i][1], axesA[i][2])) return;
+		for (int i = 0; i < 3; ++i) if (!testAxis(axesB[i][0], axesB[i][1], axesB[i][2])) return;
+
+		// 3. GbW̊O (9)iXMVector3Cross Ɠj
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				const V* a = axesA[i];
+				const V* b = axesB[j];
+				V cx = L::NegMulAdd(a[2], b[1], L::Mul(a[1], b[2]));
+				V cy = L::NegMulAdd(a[0], b[2], L::Mul(a[2], b[0]));
+				V cz = L::NegMulAdd(a[1], b[0], L::Mul(a[0], b[1]));
+				if (!testAxis(cx, cy, cz)) return;
+			}
+		}
+
+		// --- 3. o ---
+		int hit = L::MoveMask(alive) & valid;
+		alignas(32) float out4[4][W];
+		L::Store(out4[0], mtvX);
+		L::Store(out4[1], mtvY);
+		L::Store(out4[2], mtvZ);
+		L::Store(out4[3], minOverlap);
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (hit & (1 << i)) Emit(pairs[i], out4[0][i], out4[1][i], out4[2][i], out4[3][i], out);
+		}
+	}
+
+	// =================================================================
+	// JvZ vs JvZic̐m̍ŋߐړ_j
+	// =================================================================
+	template<typename L>
+	void CapsuleCapsuleBlock(const ShapePair* pairs, size_t n, std::vector<Contact>& out)
+	{
+		using V = typename L::V;
+		constexpr size_t W = L::Width;
+
+		// --- 1. W (AoS -> SoA) ---
+		alignas(32) float in[14][W];	// A n_ xyz I_ xyz a, B 
+		for (size_t i = 0; i < W; ++i)
+		{
+			const ShapePair& p = pairs[i < n ? i : 0];
+			const Physics::Capsule* caps[2] = { &p.a->capsule, &p.b->capsule };
+			for (int s = 0; s < 2; ++s)
+			{
+				const Physics::Capsule& c = *caps[s];
+				int base = s * 7;
+				in[base + 0][i] = c.start.x; in[base + 1][i] = c.start.y; in[base + 2][i] = c.start.z;
+				in[base + 3][i] = c.end.x; in[base + 4][i] = c.end.y; in[base + 5][i] = c.end.z;
+				in[base + 6][i] = c.radius;
+			}
+		}
+
+		V p1[3], p2[3], d1[3], d2[3], r[3];
+		for (int k = 0; k < 3; ++k)
+		{
+			p1[k] = L::Load(in[k]);
+			p2[k] = L::Load(in[7 + k]);
+			d1[k] = L::Sub(L::Load(in[3 + k]), p1[k]);
+			d2[k] = L::Sub(L::Load(in[10 + k]), p2[k]);
+			r[k] = L::Sub(p1[k], p2[k]);
+		}
+
+		// --- 2. SegmentSegmentDistanceSq Ɠi͑SvZđIԁj ---
+		V a = Dot<L>(d1[0], d1[1], d1[2], d1[0], d1[1], d1[2]);
+		V e = Dot<L>(d2[0], d2[1], d2[2], d2[0], d2[1], d2[2]);
+		V f = Dot<L>(d2[0], d2[1], d2[2], r[0], r[1], r[2]);
+		V c = Dot<L>(d1[0], d1[1], d1[2], r[0], r[1], r[2]);
+		V b = Dot<L>(d1[0], d1[1], d1[2], d2[0], d2[1], d2[2]);
+
+		V zero = L::Set(0.0f), one = L::Set(1.0f), eps = L::Set(1e-6f);
+		V aPoint = L::LessEqual(a, eps);	// A ̐c_
+		V ePoint = L::LessEqual(e, eps);	// B ̐c_
+
+		// 
+		V denom = L::Sub(L::Mul(a, e), L::Mul(b, b));
+		V s = L::Select(L::NotEqual(denom, zero), Clamp01<L>(L::Div(L::Sub(L::Mul(b, f), L::Mul(c, e)), denom)), zero);
+		V t = L::Div(L::Add(L::Mul(b, s), f), e);
+		V tLow = L::Less(t, zero);
+		V tHigh = L::AndNot(tLow, L::Greater(t, one));
+		V sOnA = Clamp01<L>(L::Div(L::Neg(c), a));	// t = 0 ̎ s
+		s = L::Select(tLow, sOnA, L::Select(tHigh, Clamp01<L>(L::Div(L::Sub(b, c), a)), s));
+		t = L::Select(tLow, zero, L::Select(tHigh, one, t));
+
+		// ǂ炩_
+		s = L::Select(aPoint, zero, L::Select(ePoint, sOnA, s));
+		t = L::Select(aPoint, Clamp01<L>(L::Div(f, e)), L::Select(ePoint, zero, t));
+
+		// _Ȃ[_̂
+		V bothPoint = L::And(aPoint, ePoint);
+		V c1[3], c2[3], diff[3];
+		for (int k = 0; k < 3; ++k)
+		{
+			c1[k] = L::Select(bothPoint, p1[k], L::Add(p1[k], L::Mul(d1[k], s)));
+			c2[k] = L::Select(bothPoint, p2[k], L::Add(p2[k], L::Mul(d2[k], t)));
+			diff[k] = L::Sub(c1[k], c2[k]);
+		}
+
+		// --- 3. CheckCapsuleCapsule Ɠ ---
+		V distSq = Dot<L>(diff[0], diff[1], diff[2], diff[0], diff[1], diff[2]);
+		V rSum = L::Add(L::Load(in[6]), L::Load(in[13]));
+
+		int hit = L::MoveMask(L::NotGreaterEqual(distSq, L::Mul(rSum, rSum))) & ((1 << n) - 1);
+		if (hit == 0) return;
+
+		V dist = L::Sqrt(distSq);
+		V overlapped = L::Less(dist, L::Set(1e-4f));	// c
+		dist = L::Select(overlapped, zero, dist);
+
+		// A -> B
+		alignas(32) float out4[4][W];
+		L::Store(out4[0], L::Select(overlapped, zero, L::Div(L::Sub(c2[0], c1[0]), dist)));
+		L::Store(out4[1], L::Select(overlapped, one, L::Div(L::Sub(c2[1], c1[1]), dist)));
+		L::Store(out4[2], L::Select(overlapped, zero, L::Div(L::Sub(c2[2], c1[2]), dist)));
+		L::Store(out4[3], L::Sub(rSum, dist));
+
+		// --- 4. [o ---
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (hit & (1 << i)) Emit(pairs[i], out4[0][i], out4[1][i], out4[2][i], out4[3][i], out);
+		}
+	}
+
+	/**
+	 * @brief	WubNɕĔi[͖ߑēJ[lŏj
+	 */
+	template<typename Func>
+	void ForEachBlock(size_t count, Func&& block)
+	{
+		bool avx2 = TransformBatch::GetBestPath() == TransformBatch::Path::AVX2;
+		size_t width = avx2 ? LaneAVX2::Width : LaneSSE::Width;
+		for (size_t i = 0; i < count; i += width)
+		{
+			size_t n = std::min(width, count - i);
+			if (avx2) block(LaneAVX2(), i, n);
+			else block(LaneSSE(), i, n);
+		}
+	}
+#endif // NARROW_PHASE_BATCH_SIMD
+}
+
+namespace NarrowPhaseBatch
+{
+	bool IsAvailable()
+	{
+#if NARROW_PHASE_BATCH_SIMD
+		return TransformBatch::GetBestPath() != TransformBatch::Path::Scalar;
+#else
+		return false;
+#endif
+	}
+
+	void SphereSphere(const ShapePair* pairs, size_t count, std::vector<Contact>& out)
+	{
+#if NARROW_PHASE_BATCH_SIMD
+		ForEachBlock(count, [&](auto lane, size_t i, size_t n) {
+			SphereSphereBlock<decltype(lane)>(pairs + i, n, out);
+			});
+#endif
+	}
+
+	void SphereOBB(const ShapePair* pairs, size_t count, std::vector<Contact>& out, std::vector<ShapePair>& deep)
+	{
+#if NARROW_PHASE_BATCH_SIMD
+		ForEachBlock(count, [&](auto lane, size_t i, size_t n) {
+			SphereOBBBlock<decltype(lane)>(pairs + i, n, out, deep);
+			});
+#endif
+	}
+
+	void OBBOBB(const ShapePair* pairs, size_t count, std::vector<Contact>& out)
+	{
+#if NARROW_PHASE_BATCH_SIMD
+		ForEachBlock(count, [&](auto lane, size_t i, size_t n) {
+			OBBOBBBlock<decltype(lane)>(pairs + i, n, out);
+			});
+#endif
+	}
+
+	void CapsuleCapsule(const ShapePair* pairs, size_t count, std::vector<Contact>& out)
+	{
+#if NARROW_PHASE_BATCH_SIMD
+		ForEachBlock(count, [&](auto lane, size_t i, size_t n) {
+			CapsuleCapsuleBlock<decltype(lane)>(pairs + i, n, out);
+			});
+#endif
+	}
+}
@@ -0,0 +1,62 @@
+/*****************************************************************//**
+ * @file	NarrowPhaseBatch.h
+ * @brief	`̑gݍ킹Ƃɂ܂Ƃ߂Ĕ肷i[tF[YSIMDJ[l
+ *
+ * @details
+ * yA - / - / - / JvZ-JvZ ɐU蕪ASoAɋlߑւ
+ * 4iSSEj/ 8iAVX2jɔ肵܂B
+ * vZ̏Ԃ CollisionSystem  Check* ֐ƓɂĂA
+ * ʁip̔E@E߂荞ݗʁj̓XJ[łƃrbgPʂňv܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	ȊȎgiJvZƋEA~AbVj̓J[l̂ŁA
+ *			CollisionSystem ̏ŃXJ[ / GJK Ŕ肵܂B
+ *********************************************************************/
+
+#ifndef ___NARROW_PHASE_BATCH_H___
+#define ___NARROW_PHASE_BATCH_H___
+
+// ===== CN[h =====
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include <vector>
+#include <cstddef>
+
+namespace NarrowPhaseBatch
+{
+	// SIMDoHg邩igȂł CollisionSystem XJ[Ŕ肷j
+	// CPU̔ TransformBatch::GetBestPath() Ƌ
+	bool IsAvailable();
+
+	/**
+	 * @brief	 vs iCheckSphereSphere Ɠʁj
+	 * @param	pairs	a, b Ƃɋ
+	 */
+	void SphereSphere(const Physics::ShapePair* pairs, size_t count, std::vector<Physics::Contact>& out);
+
+	/**
+	 * @brief	 vs iCheckSphereOBB ƓʁB a Ȃ@𔽓]j
+	 * @param	deep	̒S̒ɂyAiXJ[Ŕ肵Ɓj
+	 */
+	void SphereOBB(const Physics::ShapePair* pairs, size_t count, std::vector<Physics::Contact>& out, std::vector<Physics::ShapePair>& deep);
+
+	/**
+	 * @brief	 vs iCheckOBBOBB Ɠ15̕j
+	 */
+	void OBBOBB(const Physics::ShapePair* pairs, size_t count, std::vector<Physics::Contact>& out);
+
+	/**
+	 * @brief	JvZ vs JvZiCheckCapsuleCapsule Ɠʁj
+	 */
+	void CapsuleCapsule(const Physics::ShapePair* pairs, size_t count, std::vector<Physics::Contact>& out);
+}
+
+#endif // !___NARROW_PHASE_BATCH_H___
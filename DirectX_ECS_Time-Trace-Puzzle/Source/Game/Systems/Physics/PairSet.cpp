@@ -0,0 +1,148 @@
+/*****************************************************************//**
+ * @file	PairSet.cpp
+ * @brief	dȂĂEntity̑gAt[܂ŊoĂW
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/PairSet.h"
+#include <algorithm>
+
+namespace Physics
+{
+	namespace
+	{
+		constexpr size_t MinSlots = 64;
+	}
+
+	PairSet::PairSet()
+	{
+		m_slots.resize(MinSlots);
+	}
+
+	// 64bit ̍킹isplitmix64 ̎dグj
+	uint64_t PairSet::Hash(uint64_t key)
+	{
+		key ^= key >> 30;
+		key *= 0xBF58476D1CE4E5B9ull;
+		key ^= key >> 27;
+		key *= 0x94D049BB133111EBull;
+		key ^= key >> 31;
+		return key;
+	}
+
+	size_t PairSet::FindSlot(uint64_t key) const
+	{
+		size_t mask = m_slots.size() - 1;
+		size_t i = Hash(key) & mask;
+		while (m_slots[i].key != EmptyKey && m_slots[i].key != key) i = (i + 1) & mask;
+		return i;
+	}
+
+	bool PairSet::Contains(uint64_t key) const
+	{
+		return m_slots[FindSlot(key)].key == key;
+	}
+
+	void PairSet::Insert(uint64_t key, uint32_t frame)
+	{
+		if ((m_count + 1) * 2 > m_slots.size()) Rehash(m_slots.size() * 2);
+
+		Slot& slot = m_slots[FindSlot(key)];
+		if (slot.key == EmptyKey) ++m_count;
+		slot.key = key;
+		slot.frame = frame;
+	}
+
+	// ̗vflߒ폜iWcȂ̂ŒTȂȂj
+	void PairSet::Erase(uint64_t key)
+	{
+		size_t mask = m_slots.size() - 1;
+		size_t hole = FindSlot(key);
+		if (m_slots[hole].key != key) return;
+
+		m_slots[hole] = Slot();
+		--m_count;
+
+		for (size_t i = (hole + 1) & mask; m_slots[i].key != EmptyKey; i = (i + 1) & mask)
+		{
+			// {̈ʒu (hole, i] ̊OȂAɈڂĂTŌ
+			size_t home = Hash(m_slots[i].key) & mask;
+			bool between = (hole <= i) ? (hole < home && home <= i) : (hole < home || home <= i);
+			if (between) continue;
+
+			m_slots[hole] = m_slots[i];
+			m_slots[i] = Slot();
+			hole = i;
+		}
+	}
+
+	void PairSet::Rehash(size_t slotCount)
+	{
+		std::vector<Slot> old;
+		old.swap(m_slots);
+		m_slots.assign(std::max(slotCount, MinSlots), Slot());
+		m_count = 0;
+		for (const Slot& slot : old)
+		{
+			if (slot.key != EmptyKey) Insert(slot.key, slot.frame);
+		}
+	}
+
+	void PairSet::Clear()
+	{
+		m_slots.assign(MinSlots, Slot());
+		m_count = 0;
+	}
+
+	void PairSet::Update(const std::vector<uint64_t>& current,
+		std::vector<uint64_t>& entered, std::vector<uint64_t>& stayed, std::vector<uint64_t>& exited)
+	{
+		entered.clear();
+		stayed.clear();
+		exited.clear();
+		++m_frame;
+
+		// --- 1. t[̑gɈtiΒǉj ---
+		for (uint64_t key : current)
+		{
+			Slot& slot = m_slots[FindSlot(key)];
+			if (slot.key == key)
+			{
+				slot.frame = m_frame;
+				stayed.push_back(key);
+			}
+			else
+			{
+				Insert(key, m_frame);
+				entered.push_back(key);
+			}
+		}
+
+		// --- 2. ̕tȂg菜 ---
+		for (const Slot& slot : m_slots)
+		{
+			if (slot.key != EmptyKey && slot.frame != m_frame) exited.push_back(slot.key);
+		}
+		for (uint64_t key : exited) Erase(key);
+		std::sort(exited.begin(), exited.end());
+
+		// --- 3. 傫\k߂ ---
+		if (m_slots.size() > MinSlots && m_count * 8 < m_slots.size()) Rehash(m_slots.size() / 4);
+	}
+}
@@ -0,0 +1,99 @@
+/*****************************************************************//**
+ * @file	PairSet.h
+ * @brief	dȂĂEntity̑gAt[܂ŊoĂW
+ *
+ * @details
+ * Entity ̑g 64bit ̃L[ɂāAI[vAhX@̃nbV\ɓ܂B
+ * t[ut[dȂĂgvnƁAOt[Ƃ̍
+ * iEnterj/ ĂiStayj/ ꂽiExitjgԂ܂B
+ * gK[ڐG̊JnEICxgɎg܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___PAIR_SET_H___
+#define ___PAIR_SET_H___
+
+// ===== CN[h =====
+#include "Engine/ECS/ECS.h"
+#include <vector>
+#include <cstdint>
+
+namespace Physics
+{
+	/**
+	 * @class	PairSet
+	 * @brief	Entity ̑g̎W
+	 */
+	class PairSet
+	{
+	public:
+		PairSet();
+
+		// Ԃɂ炸L[ɂȂi32bitj
+		static uint64_t MakeKey(Entity a, Entity b)
+		{
+			return a < b ? (((uint64_t)a << 32) | b) : (((uint64_t)b << 32) | a);
+		}
+		static Entity KeyFirst(uint64_t key) { return (Entity)(key >> 32); }
+		static Entity KeySecond(uint64_t key) { return (Entity)(key & 0xFFFFFFFFu); }
+
+		/**
+		 * @brief	t[̑gŏWuAԂ
+		 * @param	current		t[dȂĂg̃L[iEdȂj
+		 * @param	entered		Ot[ɖgicurrent Ɠj
+		 * @param	stayed		Ot[ɂgicurrent Ɠj
+		 * @param	exited		t[Ȃgij
+		 */
+		void Update(const std::vector<uint64_t>& current,
+			std::vector<uint64_t>& entered, std::vector<uint64_t>& stayed, std::vector<uint64_t>& exited);
+
+		bool Contains(uint64_t key) const;
+		size_t Size() const { return m_count; }
+
+		// ĂSẴL[isŁjn
+		template<typename Func>
+		void ForEach(Func func) const
+		{
+			for (const Slot& slot : m_slots) {
+				if (slot.key != EmptyKey) func(slot.key);
+			}
+		}
+		void Clear();
+
+	private:
+		static constexpr uint64_t EmptyKey = ~0ull;
+
+		/**
+		 * @struct	Slot
+		 * @brief	nbV\1}X
+		 */
+		struct Slot
+		{
+			uint64_t key = EmptyKey;
+			uint32_t frame = 0;		// ŌɏdȂĂt[
+		};
+
+		static uint64_t Hash(uint64_t key);
+		size_t FindSlot(uint64_t key) const;	// Ȃ΋󂫃}Ẍʒu
+		void Insert(uint64_t key, uint32_t frame);
+		void Erase(uint64_t key);
+		void Rehash(size_t slotCount);
+
+		std::vector<Slot> m_slots;	// 2̗ݏAgp 1/2 ȉ
+		size_t m_count = 0;
+		uint32_t m_frame = 0;
+	};
+}
+
+#endif // !___PAIR_SET_H___
@@ -0,0 +1,321 @@
+/*****************************************************************//**
+ * @file	PhysicsBenchmark.cpp
+ * @brief	`Ȃŕׂ̍̕ʂAiKƂ̎Ԃv
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/PhysicsBenchmark.h"
+#include "Game/Systems/Physics/PhysicsSystem.h"
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include "Game/Systems/Physics/TriangleMesh.h"
+#include "Game/Systems/Logic/HierarchySystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace Physics
+{
+	namespace
+	{
+		Entity AddStatic(Registry& registry, const XMFLOAT3& pos, const XMFLOAT3& rot, const XMFLOAT3& scale, const Collider& collider)
+		{
+			Entity e = registry.create();
+			registry.emplace<Transform>(e, Transform(pos, rot, scale));
+			registry.emplace<Collider>(e, collider);
+			return e;
+		}
+
+		Entity AddDynamic(Registry& registry, const XMFLOAT3& pos, const Collider& collider, const XMFLOAT3& velocity = { 0.0f, 0.0f, 0.0f })
+		{
+			Entity e = registry.create();
+			registry.emplace<Transform>(e, Transform(pos));
+			registry.emplace<Collider>(e, collider);
+			Rigidbody rb(BodyType::Dynamic);
+			rb.velocity = velocity;
+			registry.emplace<Rigidbody>(e, rb);
+			return e;
+		}
+
+		// 0 .. 1 ̌܂h炬iʂ𖈉񓯂ɂj
+		float Jitter(size_t i)
+		{
+			return (float)((i * 2654435761u) % 1000u) / 1000.0f;
+		}
+
+		// --- lpɐςށi1iƂɔ炷j ---
+		void BuildPyramidStack(Registry& registry, float scale)
+		{
+			const size_t target = (size_t)(10000 * scale);
+			// íA1iڂ levels iڂ܂ł̌̘a target 𒴂܂
+			int levels = 0;
+			for (size_t total = 0; total < target; total += (size_t)levels * levels) ++levels;
+
+			AddStatic(registry, { 0.0f, -0.5f, 0.0f }, { 0, 0, 0 }, { levels + 8.0f, 1.0f, levels + 8.0f }, Collider());
+			for (int level = 0; level < levels; ++level) {
+				int side = levels - level;
+				float origin = -0.5f * (side - 1);
+				for (int x = 0; x < side; ++x) {
+					for (int z = 0; z < side; ++z) {
+						AddDynamic(registry, { origin + x, 0.5f + level, origin + z }, Collider());
+					}
+				}
+			}
+		}
+
+		// --- iqɕׂiƂɂ炵ď֍~点 ---
+		void BuildSphereRain(Registry& registry, float scale)
+		{
+			const size_t count = (size_t)(50000 * scale);
+			const int layers = 20;
+			const float spacing = 0.6f;
+			const int side = std::max(1, (int)std::ceil(std::sqrt((double)count / layers)));
+			const float half = side * spacing * 0.5f;
+
+			AddStatic(registry, { 0.0f, -0.5f, 0.0f }, { 0, 0, 0 }, { side * spacing + 4.0f, 1.0f, side * spacing + 4.0f }, Collider());
+			for (size_t i = 0; i < count; ++i) {
+				int x = (int)(i % side);
+				int z = (int)((i / side) % side);
+				int y = (int)(i / ((size_t)side * side));
+				float shift = 0.2f * (Jitter(y) - 0.5f);
+				AddDynamic(registry, { x * spacing - half + shift, 2.0f + y * 1.0f, z * spacing - half - shift },
+					Collider::CreateSphere(0.25f), { 0.0f, -2.0f * Jitter(i), 0.0f });
+			}
+		}
+
+		// --- O֌Xǂň͂񂾂蔫ɁAJvZƉ~݂ɗƂ ---
+		void BuildCapsuleBowl(Registry& registry, float scale)
+		{
+			const size_t count = (size_t)(4000 * scale);
+			const float radius = std::max(4.0f, std::sqrt((float)count) * 0.5f);
+			const int walls = 24;
+			const float wallLength = radius;
+			const float tilt = XM_PIDIV4;
+			const float width = XM_2PI * (radius + wallLength) / walls;
+
+			AddStatic(registry, { 0.0f, -0.5f, 0.0f }, { 0, 0, 0 }, { radius * 2.0f + 2.0f, 1.0f, radius * 2.0f + 2.0f }, Collider());
+			for (int i = 0; i < walls; ++i) {
+				// ǂ Z OAY ΂ߏɌi̒[a radius ̉~ɏj
+				float angle = XM_2PI * i / walls;
+				float r = radius + 0.5f * wallLength * std::sin(tilt);
+				XMFLOAT3 pos = { r * std::cos(angle), 0.5f * wallLength * std::cos(tilt), r * std::sin(angle) };
+				AddStatic(registry, pos, { tilt, XM_PIDIV2 - angle, 0.0f }, { width, wallLength, 1.0f }, Collider());
+			}
+
+			const float spacing = 1.2f;
+			const int side = std::max(1, (int)(radius * 1.2f / spacing));
+			const int perLayer = side * side;
+			for (size_t i = 0; i < count; ++i) {
+				int x = (int)(i % side);
+				int z = (int)((i / side) % side);
+				int y = (int)(i / perLayer);
+				XMFLOAT3 pos = { (x - 0.5f * side) * spacing, 1.5f + y * 1.4f, (z - 0.5f * side) * spacing };
+				Collider collider = (i % 2 == 0) ? Collider::CreateCapsule(0.3f, 1.0f) : Collider::CreateCylinder(0.4f, 0.8f);
+				AddDynamic(registry, pos, collider, { Jitter(i) - 0.5f, 0.0f, Jitter(i + 7) - 0.5f });
+			}
+		}
+
+		// iSE]E傫j 12 ̎Op`𑫂
+		void AppendBox(std::vector<XMFLOAT3>& vertices, std::vector<uint32_t>& indices, const XMFLOAT3& pos, const XMFLOAT3& rot, const XMFLOAT3& size)
+		{
+			// _̔ԍ bit0 = +X, bit1 = +Y, bit2 = +Z
+			static const uint32_t faces[12][3] = {
+				{ 0, 2, 6 }, { 0, 6, 4 }, { 1, 5, 7 }, { 1, 7, 3 },
+				{ 0, 4, 5 }, { 0, 5, 1 }, { 2, 3, 7 }, { 2, 7, 6 },
+				{ 0, 1, 3 }, { 0, 3, 2 }, { 4, 6, 7 }, { 4, 7, 5 },
+			};
+			XMMATRIX world = XMMatrixScaling(size.x, size.y, size.z) *
+				XMMatrixRotationRollPitchYaw(rot.x, rot.y, rot.z) * XMMatrixTranslation(pos.x, pos.y, pos.z);
+
+			const uint32_t base = (uint32_t)vertices.size();
+			for (int i = 0; i < 8; ++i) {
+				XMVECTOR corner = XMVectorSet((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f, 1.0f);
+				XMFLOAT3 v; XMStoreFloat3(&v, XMVector3TransformCoord(corner, world));
+				vertices.push_back(v);
+			}
+			for (const auto& f : faces) {
+				for (uint32_t k : f) indices.push_back(base + k);
+			}
+		}
+
+		// MeshLevel ̒n`̃L[iv̊Ԃ TriangleMeshLibrary ɒuj
+		const char* const LevelMeshKey = "__benchmark_level";
+
+		// v̌iCollisionSystem ̔ǰjɁAꎞIɓo^n`̃bVO
+		// OȂƁACu̐オςēĂV[̐ÓIBVH܂ō蒼ɂȂ
+		struct TemporaryMesh
+		{
+			const char* key = nullptr;
+			~TemporaryMesh() { if (key) TriangleMeshLibrary::Instance().Unregister(key); }
+		};
+
+		// --- ^CEEׂ傫Ȓn`̏ɁAFXȌ`] ---
+		// asMesh Ȃ瓯n`𔠂ł͂Ȃ1 MeshCollideri^CƂ̏̎lp` + E̔̎Op`jɂ
+		void BuildStaticLevel(Registry& registry, float scale, bool asMesh)
+		{
+			const int tiles = std::max(4, (int)(100 * std::sqrt(scale)));
+			const float tile = 2.0f;
+			const float half = tiles * tile * 0.5f;
+
+			std::vector<XMFLOAT3> vertices;
+			std::vector<uint32_t> indices;
+			auto addBox = [&](const XMFLOAT3& pos, const XMFLOAT3& rot, const XMFLOAT3& size) {
+				if (asMesh) AppendBox(vertices, indices, pos, rot, size);
+				else AddStatic(registry, pos, rot, size, Collider());
+				};
+
+			for (int x = 0; x < tiles; ++x) {
+				for (int z = 0; z < tiles; ++z) {
+					float px = x * tile - half + 1.0f, pz = z * tile - half + 1.0f;
+					if (asMesh) {
+						// ͏̖ʁiy = 0j
+						const uint32_t base = (uint32_t)vertices.size();
+						vertices.push_back({ px - 1.0f, 0.0f, pz - 1.0f });
+						vertices.push_back({ px + 1.0f, 0.0f, pz - 1.0f });
+						vertices.push_back({ px + 1.0f, 0.0f, pz + 1.0f });
+						vertices.push_back({ px - 1.0f, 0.0f, pz + 1.0f });
+						for (uint32_t k : { 0u, 2u, 1u, 0u, 3u, 2u }) indices.push_back(base + k);
+					}
+					else AddStatic(registry, { px, -0.5f, pz }, { 0, 0, 0 }, { tile, 1.0f, tile }, Collider());
+
+					int index = x * tiles + z;
+					if (index % 5 == 0) addBox({ px, 1.5f, pz }, { 0, 0, 0 }, { 0.5f, 3.0f, 0.5f });
+					else if (index % 7 == 0) addBox({ px, 0.3f, pz }, { 0.3f, 0.0f, 0.0f }, { tile, 0.2f, tile });
+				}
+			}
+			if (asMesh) {
+				TriangleMeshLibrary::Instance().Register(LevelMeshKey, std::move(vertices), indices);
+				AddStatic(registry, { 0.0f, 0.0f, 0.0f }, { 0, 0, 0 }, { 1.0f, 1.0f, 1.0f }, Collider::CreateMesh(LevelMeshKey));
+			}
+
+			const size_t count = (size_t)(2000 * scale);
+			for (size_t i = 0; i < count; ++i) {
+				XMFLOAT3 pos = { (Jitter(i) - 0.5f) * 2.0f * (half - 2.0f), 4.0f + 2.0f * Jitter(i + 3), (Jitter(i + 11) - 0.5f) * 2.0f * (half - 2.0f) };
+				XMFLOAT3 velocity = { 4.0f * (Jitter(i + 5) - 0.5f), 0.0f, 4.0f * (Jitter(i + 13) - 0.5f) };
+				Collider collider = (i % 3 == 0) ? Collider::CreateSphere(0.4f) : (i % 3 == 1) ? Collider() : Collider::CreateCapsule(0.3f, 1.0f);
+				AddDynamic(registry, pos, collider, velocity);
+			}
+		}
+
+		// Dynamic ̉^GlM[ + ʒuGlM[iy = 0 j
+		double ComputeEnergy(Registry& registry)
+		{
+			double energy = 0.0;
+			registry.view<Transform, Rigidbody>([&](Entity, Transform& t, Rigidbody& rb) {
+				if (rb.type != BodyType::Dynamic) return;
+				const XMFLOAT3& v = rb.velocity;
+				double speedSq = (double)v.x * v.x + (double)v.y * v.y + (double)v.z * v.z;
+				energy += 0.5 * rb.mass * speedSq + (double)rb.mass * PhysicsSystem::Gravity * t.position.y;
+				});
+			return energy;
+		}
+	}
+
+	const char* GetBenchmarkSceneName(BenchmarkScene scene)
+	{
+		switch (scene) {
+		case BenchmarkScene::PyramidStack: return "pyramid";
+		case BenchmarkScene::SphereRain: return "rain";
+		case BenchmarkScene::CapsuleBowl: return "bowl";
+		case BenchmarkScene::StaticLevel: return "level";
+		case BenchmarkScene::MeshLevel: return "meshlevel";
+		default: return "unknown";
+		}
+	}
+
+	SceneBenchmarkResult RunSceneBenchmark(BenchmarkScene scene, float scale, int steps)
+	{
+		SceneBenchmarkResult result;
+		result.scene = scene;
+		if (scale <= 0.0f || steps <= 0) return result;
+
+		// --- 1. ʂ ---
+		TemporaryMesh levelMesh;	// registryEcollision ɍAɔj
+		if (scene == BenchmarkScene::MeshLevel) levelMesh.key = LevelMeshKey;
+		Registry registry;
+		switch (scene) {
+		case BenchmarkScene::PyramidStack: BuildPyramidStack(registry, scale); break;
+		case BenchmarkScene::SphereRain: BuildSphereRain(registry, scale); break;
+		case BenchmarkScene::CapsuleBowl: BuildCapsuleBowl(registry, scale); break;
+		case BenchmarkScene::StaticLevel: BuildStaticLevel(registry, scale, false); break;
+		case BenchmarkScene::MeshLevel: BuildStaticLevel(registry, scale, true); break;
+		default: return result;
+		}
+		registry.view<Collider>([&](Entity e, Collider&) {
+			if (registry.has<Rigidbody>(e)) ++result.dynamicBodies;
+			else ++result.staticBodies;
+			});
+
+		PhysicsSystem physics;
+		HierarchySystem hierarchy;
+		CollisionSystem collision;
+
+		// ÓIȂ̂̍sƐÓIBVH͌v̑OɍĂ
+		hierarchy.Update(registry);
+		result.energyStart = ComputeEnergy(registry);
+
+		// --- 2. SceneGame ƓԂŁAdt Œ肵Đi߂ ---
+		using Clock = std::chrono::high_resolution_clock;
+		auto elapsed = [](Clock::time_point from, Clock::time_point to) {
+			return std::chrono::duration<double, std::milli>(to - from).count();
+			};
+
+		const float dt = Determinism::FixedDeltaTime;
+		double energy = result.energyStart;
+		size_t contactSum = 0;
+		for (int step = 0; step < steps; ++step) {
+			Clock::time_point start = Clock::now();
+			physics.Step(registry, dt);
+			Clock::time_point integrated = Clock::now();
+			hierarchy.Update(registry);
+			Clock::time_point composed = Clock::now();
+			collision.Step(registry, dt);
+			Clock::time_point end = Clock::now();
+
+			const StepTimings& timings = collision.GetTimings();
+			result.integrateMs += elapsed(start, integrated);
+			result.hierarchyMs += elapsed(integrated, composed);
+			result.proxyMs += timings.proxyMs;
+			result.broadphaseMs += timings.broadphaseMs;
+			result.narrowPhaseMs += timings.narrowPhaseMs;
+			result.solveMs += timings.solveMs;
+			result.otherMs += timings.otherMs;
+			result.totalMs += elapsed(start, end);
+
+			contactSum += collision.GetContactCount();
+			result.maxContacts = std::max(result.maxContacts, collision.GetContactCount());
+
+			double next = ComputeEnergy(registry);
+			result.maxEnergyGain = std::max(result.maxEnergyGain, next - energy);
+			energy = next;
+		}
+
+		// --- 3. 1Xebvɂ ---
+		result.steps = steps;
+		for (double* ms : { &result.integrateMs, &result.hierarchyMs, &result.proxyMs, &result.broadphaseMs,
+			&result.narrowPhaseMs, &result.solveMs, &result.otherMs, &result.totalMs }) {
+			*ms /= steps;
+		}
+		result.averageContacts = (double)contactSum / steps;
+		result.sleepingBodies = collision.GetIslands().GetSleepingBodyCount();
+		result.energyEnd = energy;
+		return result;
+	}
+}
@@ -0,0 +1,84 @@
+/*****************************************************************//**
+ * @file	PhysicsBenchmark.h
+ * @brief	`Ȃŕׂ̍̕ʂAiKƂ̎Ԃv
+ *
+ * @details
+ * ܂ʂp Registry ɍAPhysicsSystem -> HierarchySystem -> CollisionSystem ̏
+ * ܂Xebv dt ŒŐi߂܂iSceneGame ƓԁjB
+ * 1Xebv̐ϕEsEu[htF[YEi[tF[YE̎ԂƁA
+ * ڐG̐AGlM[i^ + ʒuj̕ωԂ̂ŁAœK̑O𐔎Ŕׂ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	ʂ̑傫 scale ŕς܂i1.0 Ŕ1E5ȂǁjB
+ *********************************************************************/
+
+#ifndef ___PHYSICS_BENCHMARK_H___
+#define ___PHYSICS_BENCHMARK_H___
+
+// ===== CN[h =====
+#include <cstddef>
+
+namespace Physics
+{
+	/**
+	 * @enum	BenchmarkScene
+	 * @brief	vp̏
+	 */
+	enum class BenchmarkScene
+	{
+		PyramidStack,	// lpɐςށi1j
+		SphereRain,		// ɋ~点i5j
+		CapsuleBowl,	// 蔫ɃJvZƉ~ē
+		StaticLevel,	// 傫ȐÓIȒn`i^CEEj̏]
+		MeshLevel,		// StaticLevel ̒n`1 MeshCollider ɂ
+
+		Count
+	};
+
+	// Oi"pyramid" / "rain" / "bowl" / "level" / "meshlevel"j
+	const char* GetBenchmarkSceneName(BenchmarkScene scene);
+
+	/**
+	 * @struct	SceneBenchmarkResult
+	 * @brief	ʂƂ̌vʁiԂ1Xebv̕ [ms]j
+	 */
+	struct SceneBenchmarkResult
+	{
+		BenchmarkScene scene = BenchmarkScene::PyramidStack;
+		size_t dynamicBodies = 0;
+		size_t staticBodies = 0;
+		int steps = 0;
+
+		double integrateMs = 0.0;		// PhysicsSystem
+		double hierarchyMs = 0.0;		// HierarchySystem
+		double proxyMs = 0.0;			// vLV쐬EA
+		double broadphaseMs = 0.0;
+		double narrowPhaseMs = 0.0;
+		double solveMs = 0.0;
+		double otherMs = 0.0;			// ECxg
+		double totalMs = 0.0;
+
+		double averageContacts = 0.0;
+		size_t maxContacts = 0;
+		size_t sleepingBodies = 0;		// Ō̃XebvŖĂ鍄
+
+		// GlM[iDynamic ̉^GlM[ + ʒuGlM[j[J]
+		double energyStart = 0.0;
+		double energyEnd = 0.0;
+		double maxEnergyGain = 0.0;		// 1Xebvőʂ̍őiڐG̉oȂǂŐ܂ꂽj
+	};
+
+	// scene  scale {̑傫ōAsteps Xebvi߂Čv
+	SceneBenchmarkResult RunSceneBenchmark(BenchmarkScene scene, float scale, int steps);
+}
+
+#endif // !___PHYSICS_BENCHMARK_H___
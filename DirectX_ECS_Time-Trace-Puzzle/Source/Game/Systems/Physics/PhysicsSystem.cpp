@@ -0,0 +1,70 @@
+/*****************************************************************//**
+ * @file	PhysicsSystem.cpp
+ * @brief	
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/PhysicsSystem.h"
+
+void PhysicsSystem::Step(Registry& registry, float dt)
+{
+	// Rigidbody  Transform 𓯂ԂɕׁAAzƂĂ܂Ƃ߂ď
+	registry.each_chunk<Rigidbody, Transform>([&](Span<const Entity>, Span<Rigidbody> bodies, Span<Transform> transforms)
+		{
+			const size_t count = bodies.size();
+
+			// 1. xXVid́ECRj
+			for (size_t i = 0; i < count; ++i)
+			{
+				Rigidbody& rb = bodies[i];
+
+				// Ă鍄̂͑x 0 Ȃ̂ŁAx^ĂΊONꂽi CollisionSystem Nj
+				if (rb.isSleeping && (rb.velocity.x != 0.0f || rb.velocity.y != 0.0f || rb.velocity.z != 0.0f)) {
+					rb.isSleeping = false;
+					rb.sleepTime = 0.0f;
+				}
+
+				IntegrateVelocity(rb, dt);
+			}
+
+			// 2. ʒuXViKinematic & DynamicAStaticƖĂ͓̂Ȃj
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Rigidbody& rb = bodies[i];
+				const float step = (rb.type == BodyType::Static || rb.isSleeping) ? 0.0f : dt;
+
+				Transform& t = transforms[i];
+				t.position.x += rb.velocity.x * step;
+				t.position.y += rb.velocity.y * step;
+				t.position.z += rb.velocity.z * step;
+			}
+
+			// 3. ifobOpjh~Zbg
+			for (size_t i = 0; i < count; ++i)
+			{
+				Rigidbody& rb = bodies[i];
+				Transform& t = transforms[i];
+				if (rb.type != BodyType::Static && t.position.y < -50.0f)
+				{
+					t.position = { 0, 10, 0 };
+					rb.velocity = { 0, 0, 0 };
+				}
+			}
+		});
+}
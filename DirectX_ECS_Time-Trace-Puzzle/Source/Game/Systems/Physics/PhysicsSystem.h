@@ -24,6 +24,7 @@
 #include "Engine/ECS/ECS.h"
 #include "Game/Components/Components.h"
 #include "Engine/Core/Time.h"
+#include "Game/Systems/Physics/Determinism.h"
 #include <vector>
 
 // ڐG
@@ -42,153 +43,37 @@ class PhysicsSystem
 	: public ISystem
 {
 public:
+	// d͉x [m/s^2]ij
+	static constexpr float Gravity = 9.81f;
+
 	PhysicsSystem() { m_systemName = "Physics System"; }
 
 	void Update(Registry& registry) override
 	{
-		float dt = Time::DeltaTime();
-		const float GRAVITY = 9.81f;
-
-		registry.view<Rigidbody, Transform>([&](Entity e, Rigidbody& rb, Transform& t)
-			{
-				// Static͉Ȃ
-				if (rb.type == BodyType::Static) return;
-
-				// Kinematic͕Zid́ERj󂯂ȂAxɂړ͓Kp
-				// Dynamic̓tɉZ
-				if (rb.type == BodyType::Dynamic)
-				{
-					// 1. d
-					if (rb.useGravity)
-					{
-						rb.velocity.y -= GRAVITY * dt;
-					}
-
-					// 2. CR
-					float dump = 1.0f - (rb.drag * dt);
-					if (dump < 0.0f) dump = 0.0f;
-					rb.velocity.x *= dump;
-					rb.velocity.z *= dump;
-					// Yij͋CR󂯂ɂݒɂ邩AŜɂ邩
-					// rb.velocity.y *= dump;
-				}
-
-				// 3. ʒuXViKinematic & Dynamicj
-				t.position.x += rb.velocity.x * dt;
-				t.position.y += rb.velocity.y * dt;
-				t.position.z += rb.velocity.z * dt;
-
-				// ifobOpjh~Zbg
-				if (t.position.y < -50.0f)
-				{
-					t.position = { 0, 10, 0 };
-					rb.velocity = { 0, 0, 0 };
-				}
-			});
+		// _[hł CollisionSystem ŒXebvƂ Step Ă
+		if (Physics::Determinism::Instance().IsEnabled()) return;
+		Step(registry, Time::DeltaTime());
 	}
 
-	static void Solve(Registry& registry, const std::vector<Physics::Contact>& contacts)
-	{
-		for (const auto& contact : contacts)
-		{
-			if (!registry.has<Rigidbody>(contact.a) || !registry.has<Rigidbody>(contact.b)) continue;
-			if (!registry.has<Transform>(contact.a) || !registry.has<Transform>(contact.b)) continue;
-
-			auto& rbA = registry.get<Rigidbody>(contact.a);
-			auto& rbB = registry.get<Rigidbody>(contact.b);
-			auto& tA = registry.get<Transform>(contact.a);
-			auto& tB = registry.get<Transform>(contact.b);
-
-			bool fixedA = (rbA.type == BodyType::Static || rbA.type == BodyType::Kinematic);
-			bool fixedB = (rbB.type == BodyType::Static || rbB.type == BodyType::Kinematic);
-
-			// ŒȂ牽Ȃ
-			if (fixedA && fixedB) continue;
+	// dt bxƈʒui߂i_̊mFȂǂ Time ʂɐi߂鎞gj
+	void Step(Registry& registry, float dt);
 
-			using namespace DirectX;
-			XMVECTOR n = XMLoadFloat3(&contact.normal); // A -> B ̖@
-			float depth = contact.depth;
-
-			// ---------------------------------------------------------
-			// 1. ꍇ (Dynamic vs Dynamic)
-			// ---------------------------------------------------------
-			if (!fixedA && !fixedB) {
-				// ʒu␳ ()
-				float totalMass = rbA.mass + rbB.mass;
-				float ratioA = rbB.mass / totalMass;
-				float ratioB = rbA.mass / totalMass;
-
-				XMVECTOR posA = XMLoadFloat3(&tA.position);
-				XMVECTOR posB = XMLoadFloat3(&tB.position);
-				posA -= n * (depth * ratioA);
-				posB += n * (depth * ratioB);
-				XMStoreFloat3(&tA.position, posA);
-				XMStoreFloat3(&tB.position, posB);
-
-				// yǉzx␳
-				// ݂̑ΑxvZA@̐ł
-				XMVECTOR velA = XMLoadFloat3(&rbA.velocity);
-				XMVECTOR velB = XMLoadFloat3(&rbB.velocity);
-				XMVECTOR relativeVel = velB - velA;
-				float velDot = XMVectorGetX(XMVector3Dot(relativeVel, n));
-
-				// ڋ߂Ăꍇ̂ (悤ƂĂ鎞͉Ȃ)
-				if (velDot < 0.0f) {
-					// ՌW(e) = 0 (˕ԂȂ) Ɖ
-					// @̑Αx𕪔zĉZ
-					XMVECTOR impulse = n * velDot;
-					velA += impulse * ratioA;
-					velB -= impulse * ratioB;
-
-					XMStoreFloat3(&rbA.velocity, velA);
-					XMStoreFloat3(&rbB.velocity, velB);
-				}
-			}
-			// ---------------------------------------------------------
-			// 2. Aꍇ (Player vs Wall)
-			// ---------------------------------------------------------
-			else if (!fixedA && fixedB) {
-				// ʒu␳ ()
-				XMVECTOR posA = XMLoadFloat3(&tA.position);
-				posA -= n * depth;
-				XMStoreFloat3(&tA.position, posA);
-
-				// yǉzx␳ (ꂪdvI)
-				XMVECTOR velA = XMLoadFloat3(&rbA.velocity);
-				// @̑xvZ
-				// ABɑ΂ -n ɉôŁAvelocity  -n ̓ςׂA
-				// ł́uǂɌvƍl΂悢B
-				// @ n  A->B Ȃ̂ŁAǂ̌Bvelocity  n ̓ςvXȂǂɌĂB
-				float velDot = XMVectorGetX(XMVector3Dot(velA, n));
-
-				// ǂɌĐiłꍇ̂ݕ␳
-				if (velDot > 0.0f) {
-					// @̐ƂŁAǂɉĊ铮ɂȂ
-					velA -= n * velDot;
-					XMStoreFloat3(&rbA.velocity, velA);
-				}
-			}
-			// ---------------------------------------------------------
-			// 3. Bꍇ (Wall vs Enemy)
-			// ---------------------------------------------------------
-			else if (fixedA && !fixedB) {
-				// ʒu␳ ()
-				XMVECTOR posB = XMLoadFloat3(&tB.position);
-				posB += n * depth;
-				XMStoreFloat3(&tB.position, posB);
-
-				// yǉzx␳
-				XMVECTOR velB = XMLoadFloat3(&rbB.velocity);
-				// B n ɉoB
-				// n  A->B Ȃ̂ŁAvelocity  n ̓ς}CiXȂA()ɌĂB
-				float velDot = XMVectorGetX(XMVector3Dot(velB, n));
-
-				if (velDot < 0.0f) {
-					velB -= n * velDot;
-					XMStoreFloat3(&rbB.velocity, velB);
-				}
-			}
-		}
+	// d́ECRőx dt bi߂iStep  1. ̎BNĂ Dynamic ςj
+	static void IntegrateVelocity(Rigidbody& rb, float dt)
+	{
+		// DynamicȊO͌W 0 / 1 ɂēŏi炵ăxNg₷j
+		// Kinematic͕Zid́ERj󂯂ȂAxɂړ͓Kp
+		const bool isDynamic = (rb.type == BodyType::Dynamic) && !rb.isSleeping;
+
+		const float gravity = (isDynamic && rb.useGravity) ? Gravity * dt : 0.0f;
+		float dump = 1.0f - (rb.drag * dt);
+		if (dump < 0.0f) dump = 0.0f;
+		if (!isDynamic) dump = 1.0f;
+
+		rb.velocity.y -= gravity;
+		// Yij͋CR󂯂ɂݒɂ邩AŜɂ邩
+		rb.velocity.x *= dump;
+		rb.velocity.z *= dump;
 	}
 };
 
@@ -0,0 +1,116 @@
+/*****************************************************************//**
+ * @file	RayBatch.cpp
+ * @brief	̃C܂Ƃ߂āi4{ / 8{jAABBƔ肷SIMDJ[l
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/RayBatch.h"
+#include "Game/Systems/Logic/TransformBatch.h"
+#include <algorithm>
+
+// x64 / SSE2Lx86 ̂SIMDoHrh
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAY_BATCH_SIMD 1
+#include <immintrin.h>
+#else
+#define RAY_BATCH_SIMD 0
+#endif
+
+namespace RayBatch
+{
+	namespace
+	{
+#if RAY_BATCH_SIMD
+		// 4[ilane j
+		// min / max  NaN ̎2Ԗڂ̈Ԃ̂ŁȀԂ AABB::IntersectRay Ɠ NaN 𖳎
+		uint32_t IntersectSSE(const RayPacket& p, const Physics::AABB& b, uint32_t lane)
+		{
+			__m128 tMin = _mm_setzero_ps();
+			__m128 tMax = _mm_load_ps(p.tMax + lane);
+
+			auto slab = [&](const float* o, const float* inv, float mn, float mx) {
+				__m128 vo = _mm_load_ps(o + lane);
+				__m128 vi = _mm_load_ps(inv + lane);
+				__m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(mn), vo), vi);
+				__m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(mx), vo), vi);
+				tMin = _mm_max_ps(_mm_min_ps(t2, t1), tMin);
+				tMax = _mm_min_ps(_mm_max_ps(t2, t1), tMax);
+				};
+			slab(p.ox, p.ix, b.min.x, b.max.x);
+			slab(p.oy, p.iy, b.min.y, b.max.y);
+			slab(p.oz, p.iz, b.min.z, b.max.z);
+
+			return (uint32_t)_mm_movemask_ps(_mm_cmple_ps(tMin, tMax)) << lane;
+		}
+
+		uint32_t IntersectAVX2(const RayPacket& p, const Physics::AABB& b)
+		{
+			__m256 tMin = _mm256_setzero_ps();
+			__m256 tMax = _mm256_load_ps(p.tMax);
+
+			auto slab = [&](const float* o, const float* inv, float mn, float mx) {
+				__m256 vo = _mm256_load_ps(o);
+				__m256 vi = _mm256_load_ps(inv);
+				__m256 t1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(mn), vo), vi);
+				__m256 t2 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(mx), vo), vi);
+				tMin = _mm256_max_ps(_mm256_min_ps(t2, t1), tMin);
+				tMax = _mm256_min_ps(_mm256_max_ps(t2, t1), tMax);
+				};
+			slab(p.ox, p.ix, b.min.x, b.max.x);
+			slab(p.oy, p.iy, b.min.y, b.max.y);
+			slab(p.oz, p.iz, b.min.z, b.max.z);
+
+			return (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(tMin, tMax, _CMP_LE_OQ));
+		}
+#else
+		uint32_t IntersectScalar(const RayPacket& p, const Physics::AABB& b)
+		{
+			uint32_t mask = 0;
+			for (uint32_t i = 0; i < MaxWidth; ++i) {
+				if (!(p.active & (1u << i))) continue;
+				if (b.IntersectRay({ p.ox[i], p.oy[i], p.oz[i] }, { p.ix[i], p.iy[i], p.iz[i] }, p.tMax[i])) mask |= 1u << i;
+			}
+			return mask;
+		}
+#endif
+	}
+
+	uint32_t GetPacketWidth()
+	{
+#if RAY_BATCH_SIMD
+		return TransformBatch::GetBestPath() == TransformBatch::Path::AVX2 ? 8 : 4;
+#else
+		return 4;
+#endif
+	}
+
+	uint32_t IntersectAABB(const RayPacket& packet, const Physics::AABB& aabb)
+	{
+#if RAY_BATCH_SIMD
+		static const uint32_t width = GetPacketWidth();
+		if (width == 8) return IntersectAVX2(packet, aabb) & packet.active;
+
+		uint32_t mask = IntersectSSE(packet, aabb, 0);
+		if (packet.active >> 4) mask |= IntersectSSE(packet, aabb, 4);
+		return mask & packet.active;
+#else
+		return IntersectScalar(packet, aabb);
+#endif
+	}
+}
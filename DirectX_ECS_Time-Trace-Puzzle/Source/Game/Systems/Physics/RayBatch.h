@@ -0,0 +1,61 @@
+/*****************************************************************//**
+ * @file	RayBatch.h
+ * @brief	̃C܂Ƃ߂āi4{ / 8{jAABBƔ肷SIMDJ[l
+ *
+ * @details
+ * C SoAiƂ̔zj́upPbgvɂ܂Ƃ߁ABVH̐ߓ_AABBƑS[ɔ肵܂B
+ * StaticBVH::RayCastPacket ߓ_EvfƂɂĂсA[̃rbgŎ}肵܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___RAY_BATCH_H___
+#define ___RAY_BATCH_H___
+
+// ===== CN[h =====
+#include "Game/Systems/Physics/DynamicAABBTree.h"
+#include <cstdint>
+
+namespace RayBatch
+{
+	// 1̃pPbgɓ郌C̍ő{
+	static constexpr uint32_t MaxWidth = 8;
+
+	/**
+	 * @struct	RayPacket
+	 * @brief	܂Ƃ߂Ĕ肷郌CigȂ[ active ̃rbg𗎂Ƃj
+	 */
+	struct RayPacket
+	{
+		alignas(32) float ox[MaxWidth] = {};	// n_
+		alignas(32) float oy[MaxWidth] = {};
+		alignas(32) float oz[MaxWidth] = {};
+		alignas(32) float ix[MaxWidth] = {};	// ̋ti0 }INFINITYj
+		alignas(32) float iy[MaxWidth] = {};
+		alignas(32) float iz[MaxWidth] = {};
+		alignas(32) float tMax[MaxWidth] = {};	// 艓ׂ͒ȂiŋߐڂT͏k߂Ăj
+		uint32_t active = 0;					// ܂ׂ郌[̃rbg
+	};
+
+	// 1̃pPbgŎgC̖{iAVX2 g 8AȊO 4j
+	// CPU̔ TransformBatch::GetBestPath() Ƌ
+	uint32_t GetPacketWidth();
+
+	/**
+	 * @brief	active ̃[̂Aaabb  [0, tMax] Ō̂̃rbg
+	 * @details	AABB::IntersectRay ƓS[ɍs܂B
+	 */
+	uint32_t IntersectAABB(const RayPacket& packet, const Physics::AABB& aabb);
+}
+
+#endif // !___RAY_BATCH_H___
@@ -0,0 +1,384 @@
+/*****************************************************************//**
+ * @file	SpatialGrid.cpp
+ * @brief	ԂZɕĊǗNX
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/SpatialGrid.h"
+#include <cmath>
+#include <algorithm>
+
+namespace Physics
+{
+	namespace
+	{
+		// ԑexŁA1肱ȏ̃Zɂ܂̂̓ZɓȂ
+		constexpr int OversizedLimit = 50;
+		constexpr size_t InitialSlots = 1024;
+	}
+
+	SpatialGrid::SpatialGrid(float cellSize)
+		: m_cellSize(cellSize)
+	{
+		float size = cellSize;
+		for (int l = 0; l < LevelCount; ++l)
+		{
+			m_levelSize[l] = size;
+			m_levelObjects[l] = 0;
+			size *= 2.0f;
+		}
+		m_slots.resize(InitialSlots);
+	}
+
+	// =================================================================
+	// L[ƃnbV
+	// =================================================================
+
+	// x 4bit + e 20biti͈͊O̍W͐܂ԂAAABBōi荞ނ̂Ōʂ͕ςȂj
+	uint64_t SpatialGrid::MakeKey(int level, int x, int y, int z)
+	{
+		return ((uint64_t)level << 60) |
+			((uint64_t)(x & 0xFFFFF) << 40) |
+			((uint64_t)(y & 0xFFFFF) << 20) |
+			(uint64_t)(z & 0xFFFFF);
+	}
+
+	// 64bit ̍킹isplitmix64 ̎dグj
+	uint64_t SpatialGrid::Hash(uint64_t key)
+	{
+		key ^= key >> 30;
+		key *= 0xBF58476D1CE4E5B9ull;
+		key ^= key >> 27;
+		key *= 0x94D049BB133111EBull;
+		key ^= key >> 31;
+		return key;
+	}
+
+	uint32_t SpatialGrid::FindCell(uint64_t key) const
+	{
+		size_t mask = m_slots.size() - 1;
+		for (size_t i = Hash(key) & mask;; i = (i + 1) & mask)
+		{
+			const Slot& slot = m_slots[i];
+			if (slot.cell == InvalidIndex) return InvalidIndex;
+			if (slot.key == key) return slot.cell;
+		}
+	}
+
+	uint32_t SpatialGrid::FindOrCreateCell(uint64_t key)
+	{
+		// gp 1/2 𒴂L
+		if ((m_cells.size() + 1) * 2 > m_slots.size()) Rehash(m_slots.size() * 2);
+
+		size_t mask = m_slots.size() - 1;
+		for (size_t i = Hash(key) & mask;; i = (i + 1) & mask)
+		{
+			Slot& slot = m_slots[i];
+			if (slot.cell == InvalidIndex)
+			{
+				slot.key = key;
+				slot.cell = (uint32_t)m_cells.size();
+				Cell cell;
+				cell.key = key;
+				m_cells.push_back(cell);
+				++m_emptyCells;
+				return slot.cell;
+			}
+			if (slot.key == key) return slot.cell;
+		}
+	}
+
+	void SpatialGrid::Rehash(size_t slotCount)
+	{
+		m_slots.assign(slotCount, Slot());
+		size_t mask = slotCount - 1;
+		for (uint32_t c = 0; c < (uint32_t)m_cells.size(); ++c)
+		{
+			size_t i = Hash(m_cells[c].key) & mask;
+			while (m_slots[i].cell != InvalidIndex) i = (i + 1) & mask;
+			m_slots[i] = { m_cells[c].key, c };
+		}
+	}
+
+	void SpatialGrid::Compact()
+	{
+		m_cells.erase(std::remove_if(m_cells.begin(), m_cells.end(),
+			[](const Cell& c) { return c.count == 0; }), m_cells.end());
+		m_emptyCells = 0;
+
+		size_t slotCount = InitialSlots;
+		while (m_cells.size() * 2 > slotCount) slotCount *= 2;
+		Rehash(slotCount);
+	}
+
+	// =================================================================
+	// o^
+	// =================================================================
+
+	void SpatialGrid::ComputeRangeAtLevel(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, int level, Range& out) const
+	{
+		float inv = 1.0f / m_levelSize[level];
+		out.level = level;
+		out.min[0] = (int)std::floor(min.x * inv);
+		out.min[1] = (int)std::floor(min.y * inv);
+		out.min[2] = (int)std::floor(min.z * inv);
+		out.max[0] = (int)std::floor(max.x * inv);
+		out.max[1] = (int)std::floor(max.y * inv);
+		out.max[2] = (int)std::floor(max.z * inv);
+	}
+
+	// 12ZȓɎ܂ԍׂxIԁB܂Ȃ falseiIuWFNgj
+	bool SpatialGrid::ComputeRange(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, Range& out) const
+	{
+		float extent = std::max({ max.x - min.x, max.y - min.y, max.z - min.z });
+		int level = 0;
+		while (level < LevelCount - 1 && extent > m_levelSize[level]) ++level;
+
+		ComputeRangeAtLevel(min, max, level, out);
+		for (int a = 0; a < 3; ++a)
+		{
+			if (out.max[a] - out.min[a] > OversizedLimit) return false;
+		}
+		return true;
+	}
+
+	void SpatialGrid::Insert(uint32_t id, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max)
+	{
+		// ُl`FbN (NaN, Infinity)
+		// ꂪȂƁAWꂽuԂɃt[Y܂
+		if (!std::isfinite(min.x) || !std::isfinite(min.y) || !std::isfinite(min.z) ||
+			!std::isfinite(max.x) || !std::isfinite(max.y) || !std::isfinite(max.z))
+		{
+			return; // o^Ȃ
+		}
+
+		if (Contains(id)) Remove(id);
+		if (m_bounds.size() <= id) m_bounds.resize(id + 1);
+
+		Bounds& b = m_bounds[id];
+		b.min = min;
+		b.max = max;
+		b.valid = true;
+		b.oversized = !ComputeRange(min, max, b.range);
+
+		if (b.oversized)
+		{
+			m_oversized.push_back(id);
+			return;
+		}
+		AddToCells(id, b.range);
+		++m_levelObjects[b.range.level];
+	}
+
+	void SpatialGrid::Move(uint32_t id, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max)
+	{
+		if (!Contains(id))
+		{
+			Insert(id, min, max);
+			return;
+		}
+
+		if (!std::isfinite(min.x) || !std::isfinite(min.y) || !std::isfinite(min.z) ||
+			!std::isfinite(max.x) || !std::isfinite(max.y) || !std::isfinite(max.z))
+		{
+			Remove(id);
+			return;
+		}
+
+		Bounds& b = m_bounds[id];
+		Range range;
+		bool oversized = !ComputeRange(min, max, range);
+
+		// Ẑ܂܂ȂAABBXViقƂǂ̃t[͂ŏIj
+		if (oversized == b.oversized && (oversized || range == b.range))
+		{
+			b.min = min;
+			b.max = max;
+			return;
+		}
+
+		Remove(id);
+		Insert(id, min, max);
+	}
+
+	void SpatialGrid::Remove(uint32_t id)
+	{
+		if (!Contains(id)) return;
+
+		Bounds& b = m_bounds[id];
+		if (b.oversized)
+		{
+			RemoveOversized(id);
+		}
+		else
+		{
+			RemoveFromCells(id, b.range);
+			--m_levelObjects[b.range.level];
+		}
+		b.valid = false;
+		b.oversized = false;
+
+		// ̃Z𒴂lߒ
+		if (m_emptyCells > InitialSlots / 4 && m_emptyCells * 2 > m_cells.size()) Compact();
+	}
+
+	void SpatialGrid::Clear()
+	{
+		std::fill(m_slots.begin(), m_slots.end(), Slot());
+		m_cells.clear();
+		m_emptyCells = 0;
+		m_entries.clear();
+		m_freeEntry = InvalidIndex;
+		m_bounds.clear();
+		m_oversized.clear();
+		std::fill(std::begin(m_levelObjects), std::end(m_levelObjects), 0u);
+	}
+
+	void SpatialGrid::AddToCells(uint32_t id, const Range& range)
+	{
+		for (int x = range.min[0]; x <= range.max[0]; ++x) {
+			for (int y = range.min[1]; y <= range.max[1]; ++y) {
+				for (int z = range.min[2]; z <= range.max[2]; ++z) {
+					uint32_t entry;
+					if (m_freeEntry != InvalidIndex)
+					{
+						entry = m_freeEntry;
+						m_freeEntry = m_entries[entry].next;
+					}
+					else
+					{
+						entry = (uint32_t)m_entries.size();
+						m_entries.emplace_back();
+					}
+
+					Cell& cell = m_cells[FindOrCreateCell(MakeKey(range.level, x, y, z))];
+					if (cell.count == 0) --m_emptyCells;
+					m_entries[entry] = { id, cell.head };
+					cell.head = entry;
+					++cell.count;
+				}
+			}
+		}
+	}
+
+	void SpatialGrid::RemoveFromCells(uint32_t id, const Range& range)
+	{
+		for (int x = range.min[0]; x <= range.max[0]; ++x) {
+			for (int y = range.min[1]; y <= range.max[1]; ++y) {
+				for (int z = range.min[2]; z <= range.max[2]; ++z) {
+					uint32_t c = FindCell(MakeKey(range.level, x, y, z));
+					if (c == InvalidIndex) continue;
+
+					Cell& cell = m_cells[c];
+					uint32_t* link = &cell.head;
+					while (*link != InvalidIndex && m_entries[*link].id != id) link = &m_entries[*link].next;
+					if (*link == InvalidIndex) continue;
+
+					uint32_t entry = *link;
+					*link = m_entries[entry].next;
+					m_entries[entry].next = m_freeEntry;
+					m_freeEntry = entry;
+
+					if (--cell.count == 0) ++m_emptyCells;
+				}
+			}
+		}
+	}
+
+	void SpatialGrid::RemoveOversized(uint32_t id)
+	{
+		auto it = std::find(m_oversized.begin(), m_oversized.end(), id);
+		if (it != m_oversized.end())
+		{
+			*it = m_oversized.back();
+			m_oversized.pop_back();
+		}
+	}
+
+	// =================================================================
+	// yA쐬
+	// =================================================================
+
+	void SpatialGrid::BuildPairs(std::vector<Pair>& outPairs) const
+	{
+		outPairs.clear();
+
+		// 1. Z̑gݍ킹ixmj
+		for (const Cell& cell : m_cells) {
+			if (cell.count < 2) continue;
+			for (uint32_t a = cell.head; a != InvalidIndex; a = m_entries[a].next) {
+				for (uint32_t b = m_entries[a].next; b != InvalidIndex; b = m_entries[b].next) {
+					AddPair(m_entries[a].id, m_entries[b].id, outPairs);
+				}
+			}
+		}
+
+		// 2. ׂx̂̕Aex̃ZT
+		int topLevel = -1;
+		for (int l = LevelCount - 1; l >= 0; --l) {
+			if (m_levelObjects[l] > 0) { topLevel = l; break; }
+		}
+		for (uint32_t id = 0; id < (uint32_t)m_bounds.size(); ++id) {
+			const Bounds& b = m_bounds[id];
+			if (!b.valid || b.oversized) continue;
+
+			for (int level = b.range.level + 1; level <= topLevel; ++level) {
+				if (m_levelObjects[level] == 0) continue;
+
+				Range range;
+				ComputeRangeAtLevel(b.min, b.max, level, range);
+				for (int x = range.min[0]; x <= range.max[0]; ++x) {
+					for (int y = range.min[1]; y <= range.max[1]; ++y) {
+						for (int z = range.min[2]; z <= range.max[2]; ++z) {
+							uint32_t c = FindCell(MakeKey(level, x, y, z));
+							if (c == InvalidIndex) continue;
+							for (uint32_t e = m_cells[c].head; e != InvalidIndex; e = m_entries[e].next) {
+								AddPair(id, m_entries[e].id, outPairs);
+							}
+						}
+					}
+				}
+			}
+		}
+
+		// 3. IuWFNg vs S
+		for (uint32_t big : m_oversized) {
+			for (uint32_t id = 0; id < (uint32_t)m_bounds.size(); ++id) {
+				if (id == big || !m_bounds[id].valid) continue;
+				// 哯m͕Е炾ǉ
+				if (m_bounds[id].oversized && id < big) continue;
+				AddPair(big, id, outPairs);
+			}
+		}
+
+		// 4. Zɂ܂IuWFNg̏diтIɂȂj
+		std::sort(outPairs.begin(), outPairs.end());
+		outPairs.erase(std::unique(outPairs.begin(), outPairs.end()), outPairs.end());
+	}
+
+	void SpatialGrid::AddPair(uint32_t a, uint32_t b, std::vector<Pair>& outPairs) const
+	{
+		const Bounds& A = m_bounds[a];
+		const Bounds& B = m_bounds[b];
+		if (A.max.x < B.min.x || B.max.x < A.min.x) return;
+		if (A.max.y < B.min.y || B.max.y < A.min.y) return;
+		if (A.max.z < B.min.z || B.max.z < A.min.z) return;
+		outPairs.push_back(a < b ? Pair(a, b) : Pair(b, a));
+	}
+}
@@ -21,95 +21,122 @@
 #define ___SPATIAL_GRID_H___
 
 // ===== CN[h =====
-#include "Engine/ECS/ECS.h"
-#include <unordered_map>
 #include <vector>
 #include <DirectXMath.h>
-#include <cmath>
+#include <cstdint>
+#include <utility>
 
 namespace Physics
 {
-	struct GridKey {
-		int x, y, z;
-		bool operator==(const GridKey& other) const {
-			return x == other.x && y == other.y && z == other.z;
-		}
-	};
-
-	struct GridKeyHash {
-		std::size_t operator()(const GridKey& k) const {
-			return ((std::hash<int>()(k.x) ^ (std::hash<int>()(k.y) << 1)) >> 1) ^ (std::hash<int>()(k.z) << 1);
-		}
-	};
-
+	/**
+	 * @class	SpatialGrid
+	 * @brief	u[htF[YiAABBZɓo^AZɂyAɂj
+	 * @details
+	 * EZ̑傫2{Ⴄ̃xẤu12ZȓɎ܂v
+	 *   ԍׂxɓo^܂BȏȂǂZōς݂܂B
+	 * EZ (x, x, y, z) 64bitɂ܂Ƃ߂L[ŁAI[vAhX@̃nbV\܂B
+	 * EZ̃Xg̓v[mۂAt[܂Ŏg񂵂܂B
+	 * EMove() ́Ao^ĂZςtւ܂B
+	 *
+	 * gFInsert / Move / Remove œo^XVABuildPairs() ŌyA
+	 */
 	class SpatialGrid {
 	public:
-		SpatialGrid(float cellSize = 5.0f) : m_cellSize(cellSize) {}
-
-		void Clear() {
-			m_grid.clear();
-		}
-
-		// IuWFNgObhɓo^
-		void Insert(Entity entity, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max) {
-
-			// 1. ُl`FbN (NaN, Infinity)
-			// ꂪȂƁAWꂽuԂɃt[Y܂
-			if (std::isnan(min.x) || std::isnan(min.y) || std::isnan(min.z) ||
-				std::isnan(max.x) || std::isnan(max.y) || std::isnan(max.z) ||
-				std::isinf(min.x) || std::isinf(max.x))
-			{
-				// Logger::LogWarning("SpatialGrid: Invalid AABB (NaN/Inf). Entity skipped.");
-				return; // o^Ȃ
-			}
+		using Pair = std::pair<uint32_t, uint32_t>;
 
-			int minX = (int)std::floor(min.x / m_cellSize);
-			int maxX = (int)std::floor(max.x / m_cellSize);
-			int minY = (int)std::floor(min.y / m_cellSize);
-			int maxY = (int)std::floor(max.y / m_cellSize);
-			int minZ = (int)std::floor(min.z / m_cellSize);
-			int maxZ = (int)std::floor(max.z / m_cellSize);
-
-			// 2. IuWFNg΍ ([v񐔐)
-			// Ȃǂ̋傷IuWFNgASt߂݂̂ɓo^ăt[Y
-			const int LIMIT = 50;
-			if (std::abs(maxX - minX) > LIMIT ||
-				std::abs(maxY - minY) > LIMIT ||
-				std::abs(maxZ - minZ) > LIMIT)
-			{
-				// ͈͂Iɋ߂ (S1Zɂ)
-				minX = maxX = (minX + maxX) / 2;
-				minY = maxY = (minY + maxY) / 2;
-				minZ = maxZ = (minZ + maxZ) / 2;
-			}
+		static constexpr int LevelCount = 12;	// ԑex̃Z cellSize * 2^11
 
-			for (int x = minX; x <= maxX; ++x) {
-				for (int y = minY; y <= maxY; ++y) {
-					for (int z = minZ; z <= maxZ; ++z) {
-						m_grid[{x, y, z}].push_back(entity);
-					}
-				}
-			}
-		}
-
-		const std::vector<Entity>& GetCell(const DirectX::XMFLOAT3& position) {
-			int x = (int)std::floor(position.x / m_cellSize);
-			int y = (int)std::floor(position.y / m_cellSize);
-			int z = (int)std::floor(position.z / m_cellSize);
-			auto it = m_grid.find({ x, y, z });
-			if (it != m_grid.end()) return it->second;
-			static const std::vector<Entity> empty;
-			return empty;
-		}
-
-		const std::unordered_map<GridKey, std::vector<Entity>, GridKeyHash>& GetMap() const {
-			return m_grid;
-		}
+		SpatialGrid(float cellSize = 5.0f);
+
+		// IuWFNgo^iid  BuildPairs ŕԂԍBNaN / Infinity ͓o^Ȃj
+		void Insert(uint32_t id, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max);
+
+		// AABB̍XVio^Ȃo^AُlȂ폜j
+		void Move(uint32_t id, const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max);
+
+		void Remove(uint32_t id);
+		bool Contains(uint32_t id) const { return id < m_bounds.size() && m_bounds[id].valid; }
+
+		// Sč폜imۂ͎cj
+		void Clear();
+
+		// AABBdȂĂyAia < bAAdȂj
+		void BuildPairs(std::vector<Pair>& outPairs) const;
+
+		// gp̃ZimFpj
+		size_t GetCellCount() const { return m_cells.size() - m_emptyCells; }
 
 	private:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+		// o^ĂZ͈̔
+		struct Range {
+			int level = 0;
+			int min[3] = {};
+			int max[3] = {};
+			bool operator==(const Range& o) const {
+				return level == o.level &&
+					min[0] == o.min[0] && min[1] == o.min[1] && min[2] == o.min[2] &&
+					max[0] == o.max[0] && max[1] == o.max[1] && max[2] == o.max[2];
+			}
+		};
+
+		struct Bounds {
+			DirectX::XMFLOAT3 min;
+			DirectX::XMFLOAT3 max;
+			Range range;
+			bool valid = false;
+			bool oversized = false;	// ԑexł傫́iSĂAABBŔrj
+		};
+
+		// ZXg̗vfiv[mہj
+		struct Entry {
+			uint32_t id;
+			uint32_t next;
+		};
+
+		struct Cell {
+			uint64_t key;
+			uint32_t head = InvalidIndex;
+			uint32_t count = 0;
+		};
+
+		// nbV\̘gicell == InvalidIndex Ȃ󂫁j
+		struct Slot {
+			uint64_t key = 0;
+			uint32_t cell = InvalidIndex;
+		};
+
+		static uint64_t MakeKey(int level, int x, int y, int z);
+		static uint64_t Hash(uint64_t key);
+
+		bool ComputeRange(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, Range& out) const;
+		void ComputeRangeAtLevel(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max, int level, Range& out) const;
+
+		uint32_t FindCell(uint64_t key) const;
+		uint32_t FindOrCreateCell(uint64_t key);
+		void Rehash(size_t slotCount);
+		void Compact();		// ̃Zlߒ
+
+		void AddToCells(uint32_t id, const Range& range);
+		void RemoveFromCells(uint32_t id, const Range& range);
+		void RemoveOversized(uint32_t id);
+
+		void AddPair(uint32_t a, uint32_t b, std::vector<Pair>& outPairs) const;
+
 		float m_cellSize;
-		std::unordered_map<GridKey, std::vector<Entity>, GridKeyHash> m_grid;
+		float m_levelSize[LevelCount];			// xƂ̃Z̑傫
+		uint32_t m_levelObjects[LevelCount];	// xƂ̓o^ĩx͒TȂj
+
+		std::vector<Slot> m_slots;			// 2̗ݏ̑傫A`T
+		std::vector<Cell> m_cells;
+		size_t m_emptyCells = 0;			// count == 0 ̃Z
+		std::vector<Entry> m_entries;
+		uint32_t m_freeEntry = InvalidIndex;
+
+		std::vector<Bounds> m_bounds;		// id -> AABB
+		std::vector<uint32_t> m_oversized;
 	};
 }
 
-#endif // !___SPATIAL_GRID_H___
\ No newline at end of file
+#endif // !___SPATIAL_GRID_H___
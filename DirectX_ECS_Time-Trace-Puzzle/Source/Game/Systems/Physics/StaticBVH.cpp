@@ -0,0 +1,185 @@
+/*****************************************************************//**
+ * @file	StaticBVH.cpp
+ * @brief	ÓIȓ蔻pBVHi쐬͕ύXȂj
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/StaticBVH.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Physics
+{
+	namespace
+	{
+		float Centroid(const AABB& b, int axis)
+		{
+			switch (axis)
+			{
+			case 0:		return (b.min.x + b.max.x) * 0.5f;
+			case 1:		return (b.min.y + b.max.y) * 0.5f;
+			default:	return (b.min.z + b.max.z) * 0.5f;
+			}
+		}
+	}
+
+	void StaticBVH::Build(const std::vector<AABB>& bounds)
+	{
+		Clear();
+		if (bounds.empty()) return;
+
+		m_bounds = bounds;
+		m_items.reserve(bounds.size());
+		for (uint32_t i = 0; i < (uint32_t)bounds.size(); ++i) {
+			// ُl (NaN, Infinity) ͓Ȃir̔ԍ͈͊OɂȂ邽߁Bvf̔ԍ bounds ̂܂܁j
+			const AABB& b = bounds[i];
+			if (!std::isfinite(b.min.x) || !std::isfinite(b.min.y) || !std::isfinite(b.min.z) ||
+				!std::isfinite(b.max.x) || !std::isfinite(b.max.y) || !std::isfinite(b.max.z)) continue;
+			m_items.push_back(i);
+		}
+		if (m_items.empty()) return;
+
+		m_nodes.reserve(m_items.size() * 2);
+		BuildRecursive(0, (uint32_t)m_items.size(), 0);
+	}
+
+	void StaticBVH::Clear()
+	{
+		m_nodes.clear();
+		m_items.clear();
+		m_bounds.clear();
+	}
+
+	uint32_t StaticBVH::BuildRecursive(uint32_t begin, uint32_t end, int depth)
+	{
+		uint32_t index = (uint32_t)m_nodes.size();
+		m_nodes.emplace_back();
+
+		// --- 1. ŜAABBƁAS_͈̔ ---
+		AABB bounds = m_bounds[m_items[begin]];
+		float cMin[3] = { INFINITY, INFINITY, INFINITY };
+		float cMax[3] = { -INFINITY, -INFINITY, -INFINITY };
+		for (uint32_t k = begin; k < end; ++k)
+		{
+			const AABB& b = m_bounds[m_items[k]];
+			bounds = AABB::Union(bounds, b);
+			for (int a = 0; a < 3; ++a)
+			{
+				float c = Centroid(b, a);
+				cMin[a] = std::min(cMin[a], c);
+				cMax[a] = std::max(cMax[a], c);
+			}
+		}
+		m_nodes[index].bounds = bounds;
+
+		uint32_t count = end - begin;
+		auto makeLeaf = [&]()
+			{
+				m_nodes[index].offset = begin;
+				m_nodes[index].count = count;
+				return index;
+			};
+		if (count <= MaxLeafSize || depth >= MaxDepth) return makeLeaf();
+
+		// --- 2. S_̍L肪ő̎rɕāASAHŏɂȂ鋫ET ---
+		int axis = 0;
+		for (int a = 1; a < 3; ++a)
+		{
+			if (cMax[a] - cMin[a] > cMax[axis] - cMin[axis]) axis = a;
+		}
+		float extent = cMax[axis] - cMin[axis];
+
+		uint32_t mid = begin;
+		if (extent > 0.0f)
+		{
+			struct Bin
+			{
+				AABB bounds;
+				uint32_t count = 0;
+			};
+			Bin bins[BinCount];
+			float scale = BinCount / extent;
+			auto binOf = [&](uint32_t item)
+				{
+					int b = (int)((Centroid(m_bounds[item], axis) - cMin[axis]) * scale);
+					return std::min(b, BinCount - 1);
+				};
+
+			for (uint32_t k = begin; k < end; ++k)
+			{
+				Bin& bin = bins[binOf(m_items[k])];
+				bin.bounds = bin.count ? AABB::Union(bin.bounds, m_bounds[m_items[k]]) : m_bounds[m_items[k]];
+				++bin.count;
+			}
+
+			// EݐςʐςƐ
+			float rightArea[BinCount];
+			uint32_t rightCount[BinCount];
+			{
+				AABB acc{};
+				uint32_t n = 0;
+				for (int b = BinCount - 1; b > 0; --b)
+				{
+					if (bins[b].count) acc = n ? AABB::Union(acc, bins[b].bounds) : bins[b].bounds;
+					n += bins[b].count;
+					rightArea[b] = n ? acc.SurfaceArea() : 0.0f;
+					rightCount[b] = n;
+				}
+			}
+
+			// ݐςȂAE bir b EցjƂ̃RXgr
+			float bestCost = INFINITY;
+			int bestSplit = -1;
+			AABB acc{};
+			uint32_t n = 0;
+			for (int b = 1; b < BinCount; ++b)
+			{
+				const Bin& bin = bins[b - 1];
+				if (bin.count) acc = n ? AABB::Union(acc, bin.bounds) : bin.bounds;
+				n += bin.count;
+				if (n == 0 || rightCount[b] == 0) continue;
+
+				float cost = acc.SurfaceArea() * n + rightArea[b] * rightCount[b];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestSplit = b;
+				}
+			}
+
+			// ȂȂtɂit傫Ȃ肷Ȃ悤ɂj
+			if (bestSplit < 0) return makeLeaf();
+			if (count <= MaxLeafSize * 4 && bestCost >= bounds.SurfaceArea() * count) return makeLeaf();
+
+			mid = (uint32_t)(std::partition(m_items.begin() + begin, m_items.begin() + end,
+				[&](uint32_t item) { return binOf(item) < bestSplit; }) - m_items.begin());
+		}
+
+		// SSʒuȂǂŕȂꍇ͔Ɋ
+		if (mid == begin || mid == end) mid = begin + count / 2;
+
+		// --- 3. qi̎q͕K index + 1 ɂȂj ---
+		BuildRecursive(begin, mid, depth + 1);
+		uint32_t right = BuildRecursive(mid, end, depth + 1);
+
+		m_nodes[index].offset = right;
+		m_nodes[index].count = 0;
+		return index;
+	}
+}
@@ -0,0 +1,195 @@
+/*****************************************************************//**
+ * @file	StaticBVH.h
+ * @brief	ÓIȓ蔻pBVHi쐬͕ύXȂj
+ *
+ * @details
+ * Ȃn`EǂȂǂAABBAxgbv_EŖ؂܂B
+ * E͕\ʐσq[XeBbNiSAHArjŌ߂܂
+ * Em[h͐[DŕׁA̎q͏Ɂu̎vɒu܂
+ * IAABBc[ƈđ}E폜͂ł܂񂪁A̕AAĂ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___STATIC_BVH_H___
+#define ___STATIC_BVH_H___
+
+// ===== CN[h =====
+#include "Game/Systems/Physics/DynamicAABBTree.h"
+#include "Game/Systems/Physics/RayBatch.h"
+#include <vector>
+#include <cstdint>
+#include <cassert>
+
+namespace Physics
+{
+	/**
+	 * @class	StaticBVH
+	 * @brief	蒼pBVH
+	 */
+	class StaticBVH
+	{
+	public:
+		// bounds[i] vf i ƂĖ؂蒼iNaNE܂ނ͓̂Ȃj
+		void Build(const std::vector<AABB>& bounds);
+		void Clear();
+
+		size_t GetItemCount() const { return m_bounds.size(); }
+		size_t GetNodeCount() const { return m_nodes.size(); }
+
+		/**
+		 * @brief	aabb ƏdȂvf񋓁ivfgAABBŔς݁j
+		 * @param	func	void(uint32_t item)
+		 */
+		template<typename Func>
+		void Query(const AABB& aabb, Func func) const
+		{
+			if (m_nodes.empty()) return;
+
+			uint32_t stack[StackSize];
+			int32_t count = 0;
+			stack[count++] = 0;
+
+			while (count > 0)
+			{
+				const Node& node = m_nodes[stack[--count]];
+				if (!node.bounds.Overlaps(aabb)) continue;
+
+				if (node.count > 0)
+				{
+					for (uint32_t k = node.offset; k < node.offset + node.count; ++k)
+					{
+						uint32_t item = m_items[k];
+						if (m_bounds[item].Overlaps(aabb)) func(item);
+					}
+				}
+				else
+				{
+					assert(count + 2 <= StackSize);
+					uint32_t self = (uint32_t)(&node - m_nodes.data());
+					stack[count++] = node.offset;	// E̎q
+					stack[count++] = self + 1;		// ̎q
+				}
+			}
+		}
+
+		/**
+		 * @brief	CAABBvf
+		 * @param	dir		Kς݂̌
+		 * @param	func	float(uint32_t item, float maxDist)BVő勗Ԃi0 őł؂j
+		 */
+		template<typename Func>
+		void RayCast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dir, float maxDist, Func func) const
+		{
+			if (m_nodes.empty()) return;
+
+			DirectX::XMFLOAT3 invDir = {
+				dir.x != 0.0f ? 1.0f / dir.x : INFINITY,
+				dir.y != 0.0f ? 1.0f / dir.y : INFINITY,
+				dir.z != 0.0f ? 1.0f / dir.z : INFINITY
+			};
+
+			uint32_t stack[StackSize];
+			int32_t count = 0;
+			stack[count++] = 0;
+
+			while (count > 0)
+			{
+				const Node& node = m_nodes[stack[--count]];
+				if (!node.bounds.IntersectRay(origin, invDir, maxDist)) continue;
+
+				if (node.count > 0)
+				{
+					for (uint32_t k = node.offset; k < node.offset + node.count; ++k)
+					{
+						uint32_t item = m_items[k];
+						if (!m_bounds[item].IntersectRay(origin, invDir, maxDist)) continue;
+						maxDist = func(item, maxDist);
+						if (maxDist <= 0.0f) return;
+					}
+				}
+				else
+				{
+					assert(count + 2 <= StackSize);
+					uint32_t self = (uint32_t)(&node - m_nodes.data());
+					stack[count++] = node.offset;
+					stack[count++] = self + 1;
+				}
+			}
+		}
+
+		/**
+		 * @brief	pPbg̃C܂Ƃ߂ĒHAAABBƌvf
+		 * @param	func	void(uint32_t item, uint32_t lanes)Blanes ͌[̃rbg
+		 *					packet.tMax k߂ active ̃rbg𗎂Ƃ肵Ă悢iSėł؂j
+		 */
+		template<typename Func>
+		void RayCastPacket(RayBatch::RayPacket& packet, Func func) const
+		{
+			if (m_nodes.empty()) return;
+
+			uint32_t stack[StackSize];
+			int32_t count = 0;
+			stack[count++] = 0;
+
+			while (count > 0 && packet.active != 0)
+			{
+				const Node& node = m_nodes[stack[--count]];
+				if (RayBatch::IntersectAABB(packet, node.bounds) == 0) continue;
+
+				if (node.count > 0)
+				{
+					for (uint32_t k = node.offset; k < node.offset + node.count; ++k)
+					{
+						uint32_t item = m_items[k];
+						uint32_t lanes = RayBatch::IntersectAABB(packet, m_bounds[item]);
+						if (lanes == 0) continue;
+						func(item, lanes);
+						if (packet.active == 0) return;
+					}
+				}
+				else
+				{
+					assert(count + 2 <= StackSize);
+					uint32_t self = (uint32_t)(&node - m_nodes.data());
+					stack[count++] = node.offset;
+					stack[count++] = self + 1;
+				}
+			}
+		}
+
+	private:
+		// łȂȂ[B[ d (< MaxDepth) ̓m[hJƁA
+		// X^bNɂ͑c̉E̎q d ȉ + q 2 ς܂̂ MaxDepth + 1 ΈȂ
+		static constexpr int MaxDepth = 60;
+		static constexpr int32_t StackSize = 64;
+		static_assert(StackSize >= MaxDepth + 1, "TX^bN MaxDepth ̖؂H܂");
+		static constexpr uint32_t MaxLeafSize = 4;
+		static constexpr int BinCount = 12;
+
+		struct Node
+		{
+			AABB bounds;
+			uint32_t offset = 0;	// tFm_items ̊Jnʒu / FE̎qi̎q͎ + 1j
+			uint32_t count = 0;		// tFvf / F0
+		};
+
+		uint32_t BuildRecursive(uint32_t begin, uint32_t end, int depth);
+
+		std::vector<Node> m_nodes;
+		std::vector<uint32_t> m_items;	// tɕׂvfԍ
+		std::vector<AABB> m_bounds;		// vfƂAABB
+	};
+}
+
+#endif // !___STATIC_BVH_H___
@@ -0,0 +1,37 @@
+/*****************************************************************//**
+ * @file	StrictFloat.h
+ * @brief	̖|Pʂŕ_̌vZʂɍs킹
+ *
+ * @details
+ * a * b + c  FMA ߂ɂ܂Ƃ߂ikjƁAۂ߂1񌸂Čʂ̃rbgς܂B
+ * RpC /fp ̐ݒE/arch ɂďk񂳂ꂽ肳Ȃ肷̂ŁA
+ *  .cpp ł͂ŏk fast-math ̕בւ~߁A
+ * ͂Ȃ瓯rbǧʂɂȂ悤ɂ܂i_[hEvCpjB
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	.cpp ̒ŁÃCN[hOɓ܂iȍ~̊֐ׂĂɌ܂jB
+ *			wb_[̓CN[hȂłiCN[h̖|PʂɂĂ܂jB
+ *********************************************************************/
+
+#ifndef ___STRICT_FLOAT_H___
+#define ___STRICT_FLOAT_H___
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#pragma float_control(precise, on)
+#pragma fp_contract(off)
+#elif defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off", "no-fast-math")
+#endif
+
+#endif // !___STRICT_FLOAT_H___
@@ -0,0 +1,252 @@
+/*****************************************************************//**
+ * @file	SweepAndPrune.cpp
+ * @brief	Sweep and Prune ɂu[htF[Y
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/SweepAndPrune.h"
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Physics
+{
+	void SweepAndPrune::Update(const std::vector<CollisionProxy>& proxies, std::vector<BroadphasePair>& outPairs)
+	{
+		for (auto& box : m_boxes) box.seen = false;
+		size_t added = 0;
+
+		// --- 1. AABB̍XVi߂ĂEntity͒[_𖖔ɒǉj ---
+		for (uint32_t i = 0; i < (uint32_t)proxies.size(); ++i)
+		{
+			const auto& p = proxies[i];
+			const float mn[3] = { p.aabbMin.x, p.aabbMin.y, p.aabbMin.z };
+			const float mx[3] = { p.aabbMax.x, p.aabbMax.y, p.aabbMax.z };
+
+			// ُl (NaN, Infinity) ͓o^Ȃi\[g邽߁j
+			bool valid = true;
+			for (int a = 0; a < 3; ++a)
+			{
+				if (!std::isfinite(mn[a]) || !std::isfinite(mx[a])) valid = false;
+			}
+			if (!valid) continue;
+
+			uint32_t handle = (p.entity < m_entityToHandle.size()) ? m_entityToHandle[p.entity] : InvalidHandle;
+			if (handle == InvalidHandle)
+			{
+				handle = AddBox(p.entity);
+				++added;
+			}
+
+			Box& box = m_boxes[handle];
+			box.proxy = i;
+			box.seen = true;
+			for (int a = 0; a < 3; ++a)
+			{
+				box.min[a] = mn[a];
+				box.max[a] = mx[a];
+				m_axes[a][box.endIndex[a][0]].value = mn[a];
+				m_axes[a][box.endIndex[a][1]].value = mx[a];
+			}
+		}
+
+		// --- 2. t[Ȃ̂폜 ---
+		RemoveDeadBoxes();
+
+		// --- 3. e}\[giւ[_ɉăyAǉE폜j ---
+		// V[ǂݍݒȂǁAʂɒǉꂽ͑}\[g O(n^2) ɂȂ̂ō蒼
+		if (added > 64 && added * 4 > proxies.size())
+		{
+			Rebuild();
+		}
+		else
+		{
+			for (int a = 0; a < 3; ++a)
+			{
+				SortAxis(a);
+			}
+		}
+
+		// --- 4. proxies ̓Yɕϊďo ---
+		outPairs.clear();
+		outPairs.reserve(m_pairs.size());
+		for (uint64_t key : m_pairs)
+		{
+			uint32_t pa = m_boxes[(uint32_t)(key >> 32)].proxy;
+			uint32_t pb = m_boxes[(uint32_t)(key & 0xFFFFFFFF)].proxy;
+			outPairs.push_back(pa < pb ? BroadphasePair(pa, pb) : BroadphasePair(pb, pa));
+		}
+		// nbV̏ԂɈˑȂ悤ׂ
+		std::sort(outPairs.begin(), outPairs.end());
+	}
+
+	bool SweepAndPrune::Overlaps(const Box& a, const Box& b) const
+	{
+		for (int k = 0; k < 3; ++k)
+		{
+			if (a.max[k] < b.min[k] || b.max[k] < a.min[k]) return false;
+		}
+		return true;
+	}
+
+	uint32_t SweepAndPrune::AddBox(Entity entity)
+	{
+		uint32_t handle;
+		if (!m_freeHandles.empty())
+		{
+			handle = m_freeHandles.back();
+			m_freeHandles.pop_back();
+		}
+		else
+		{
+			handle = (uint32_t)m_boxes.size();
+			m_boxes.emplace_back();
+		}
+
+		Box& box = m_boxes[handle];
+		box = Box();
+		box.entity = entity;
+		box.alive = true;
+
+		if (m_entityToHandle.size() <= entity) m_entityToHandle.resize(entity + 1, InvalidHandle);
+		m_entityToHandle[entity] = handle;
+
+		// iSẴ{bNXANƂdȂĂȂԁjɒǉA\[gŐʒuֈړ
+		for (int a = 0; a < 3; ++a)
+		{
+			box.endIndex[a][0] = (uint32_t)m_axes[a].size();
+			m_axes[a].push_back({ 0.0f, handle, false });
+			box.endIndex[a][1] = (uint32_t)m_axes[a].size();
+			m_axes[a].push_back({ 0.0f, handle, true });
+		}
+		return handle;
+	}
+
+	void SweepAndPrune::RemoveDeadBoxes()
+	{
+		auto isDead = [&](uint32_t h) { return m_boxes[h].alive && !m_boxes[h].seen; };
+
+		bool anyDead = false;
+		for (uint32_t h = 0; h < m_boxes.size(); ++h)
+		{
+			if (isDead(h)) { anyDead = true; break; }
+		}
+		if (!anyDead) return;
+
+		// 1. yA폜
+		for (auto it = m_pairs.begin(); it != m_pairs.end(); )
+		{
+			if (isDead((uint32_t)(*it >> 32)) || isDead((uint32_t)(*it & 0xFFFFFFFF))) it = m_pairs.erase(it);
+			else ++it;
+		}
+
+		// 2. [_l߂āAʒuU蒼
+		for (int a = 0; a < 3; ++a)
+		{
+			auto& axis = m_axes[a];
+			axis.erase(std::remove_if(axis.begin(), axis.end(),
+				[&](const EndPoint& ep) { return isDead(ep.handle); }), axis.end());
+
+			for (uint32_t i = 0; i < axis.size(); ++i)
+			{
+				m_boxes[axis[i].handle].endIndex[a][axis[i].isMax ? 1 : 0] = i;
+			}
+		}
+
+		// 3. nh
+		for (uint32_t h = 0; h < m_boxes.size(); ++h)
+		{
+			if (!isDead(h)) continue;
+			m_entityToHandle[m_boxes[h].entity] = InvalidHandle;
+			m_boxes[h].alive = false;
+			m_freeHandles.push_back(h);
+		}
+	}
+
+	void SweepAndPrune::Rebuild()
+	{
+		for (int a = 0; a < 3; ++a)
+		{
+			auto& axis = m_axes[a];
+			std::sort(axis.begin(), axis.end(), Less);
+			for (uint32_t i = 0; i < axis.size(); ++i)
+			{
+				m_boxes[axis[i].handle].endIndex[a][axis[i].isMax ? 1 : 0] = i;
+			}
+		}
+
+		// X1񑖍ăyA蒼
+		m_pairs.clear();
+		std::vector<uint32_t> active;
+		for (const auto& ep : m_axes[0])
+		{
+			if (ep.isMax)
+			{
+				active.erase(std::find(active.begin(), active.end(), ep.handle));
+				continue;
+			}
+			for (uint32_t other : active)
+			{
+				if (Overlaps(m_boxes[ep.handle], m_boxes[other])) m_pairs.insert(MakeKey(ep.handle, other));
+			}
+			active.push_back(ep.handle);
+		}
+	}
+
+	void SweepAndPrune::SortAxis(int axis)
+	{
+		auto& endPoints = m_axes[axis];
+
+		for (size_t i = 1; i < endPoints.size(); ++i)
+		{
+			EndPoint current = endPoints[i];
+			size_t j = i;
+
+			while (j > 0 && Less(current, endPoints[j - 1]))
+			{
+				const EndPoint& prev = endPoints[j - 1];
+
+				// current  prev ̑OɈړ
+				if (current.handle != prev.handle)
+				{
+					if (!current.isMax && prev.isMax)
+					{
+						// min  max Oɗ  ̎ŏdȂn߂i̎mFj
+						if (Overlaps(m_boxes[current.handle], m_boxes[prev.handle]))
+						{
+							m_pairs.insert(MakeKey(current.handle, prev.handle));
+						}
+					}
+					else if (current.isMax && !prev.isMax)
+					{
+						// max  min Oɗ  ̎ŗꂽ
+						m_pairs.erase(MakeKey(current.handle, prev.handle));
+					}
+				}
+
+				endPoints[j] = prev;
+				m_boxes[prev.handle].endIndex[axis][prev.isMax ? 1 : 0] = (uint32_t)j;
+				--j;
+			}
+
+			endPoints[j] = current;
+			m_boxes[current.handle].endIndex[axis][current.isMax ? 1 : 0] = (uint32_t)j;
+		}
+	}
+}
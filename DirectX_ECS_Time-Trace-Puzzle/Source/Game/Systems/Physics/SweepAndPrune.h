@@ -0,0 +1,89 @@
+/*****************************************************************//**
+ * @file	SweepAndPrune.h
+ * @brief	Sweep and Prune ɂu[htF[Y
+ *
+ * @details
+ * 3ꂼAABB̒[_imin / maxj\[gzA
+ * t[}\[gŕג܂B̂͂قƂǓȂ̂ŁAق O(n) ōς݂܂B
+ * [_ւyAǉE폜̂ŁAyA͍蒼܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___SWEEP_AND_PRUNE_H___
+#define ___SWEEP_AND_PRUNE_H___
+
+// ===== CN[h =====
+#include "Game/Systems/Physics/Broadphase.h"
+#include <unordered_set>
+
+namespace Physics
+{
+	class SweepAndPrune
+		: public IBroadphase
+	{
+	public:
+		void Update(const std::vector<CollisionProxy>& proxies, std::vector<BroadphasePair>& outPairs) override;
+		BroadphaseType GetType() const override { return BroadphaseType::SweepAndPrune; }
+
+		// ݒǐՂĂyA
+		size_t GetPairCount() const { return m_pairs.size(); }
+
+	private:
+		static constexpr uint32_t InvalidHandle = 0xFFFFFFFF;
+
+		// [_ilȂ min ɕׂ遁ڂĂ邾łdȂ舵j
+		struct EndPoint
+		{
+			float value;
+			uint32_t handle;
+			bool isMax;
+		};
+
+		struct Box
+		{
+			Entity entity = NullEntity;
+			uint32_t proxy = 0;			// t[ proxies ̓Y
+			uint32_t endIndex[3][2];	// e̒[_z̈ʒu [axis][min/max]
+			float min[3];
+			float max[3];
+			bool alive = false;
+			bool seen = false;			// t[XVꂽ
+		};
+
+		static uint64_t MakeKey(uint32_t a, uint32_t b)
+		{
+			if (a > b) std::swap(a, b);
+			return ((uint64_t)a << 32) | b;
+		}
+
+		static bool Less(const EndPoint& a, const EndPoint& b)
+		{
+			return a.value < b.value || (a.value == b.value && !a.isMax && b.isMax);
+		}
+
+		bool Overlaps(const Box& a, const Box& b) const;
+		uint32_t AddBox(Entity entity);
+		void RemoveDeadBoxes();
+		void SortAxis(int axis);
+		void Rebuild();		// S\[gAyA蒼
+
+		std::vector<Box> m_boxes;
+		std::vector<uint32_t> m_freeHandles;
+		std::vector<uint32_t> m_entityToHandle;	// Entity -> nh
+		std::vector<EndPoint> m_axes[3];
+		std::unordered_set<uint64_t> m_pairs;		// dȂĂnh̑g
+	};
+}
+
+#endif // !___SWEEP_AND_PRUNE_H___
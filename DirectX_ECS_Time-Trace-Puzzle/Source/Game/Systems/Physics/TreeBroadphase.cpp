@@ -0,0 +1,124 @@
+/*****************************************************************//**
+ * @file	TreeBroadphase.cpp
+ * @brief	IAABBc[ɂu[htF[Y
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/TreeBroadphase.h"
+#include "Game/Systems/Physics/CollisionSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Physics
+{
+	void TreeBroadphase::Update(const std::vector<CollisionProxy>& proxies, std::vector<BroadphasePair>& outPairs)
+	{
+		++m_frame;
+		m_moved.clear();
+
+		// --- 1. t̒ǉEXV ---
+		for (uint32_t i = 0; i < (uint32_t)proxies.size(); ++i)
+		{
+			const auto& p = proxies[i];
+			AABB aabb = { p.aabbMin, p.aabbMax };
+
+			// ُl (NaN, Infinity) ͓o^Ȃic[邽߁j
+			if (!std::isfinite(aabb.min.x) || !std::isfinite(aabb.min.y) || !std::isfinite(aabb.min.z) ||
+				!std::isfinite(aabb.max.x) || !std::isfinite(aabb.max.y) || !std::isfinite(aabb.max.z)) continue;
+
+			if (m_entityToLeaf.size() <= p.entity)
+			{
+				m_entityToLeaf.resize(p.entity + 1, DynamicAABBTree::NullNode);
+				m_seenFrame.resize(p.entity + 1, 0);
+			}
+
+			int32_t& leaf = m_entityToLeaf[p.entity];
+			if (leaf == DynamicAABBTree::NullNode)
+			{
+				leaf = m_tree.CreateProxy(aabb, i);
+				m_entities.push_back(p.entity);
+				m_moved.push_back(leaf);
+			}
+			else
+			{
+				if (m_tree.MoveProxy(leaf, aabb)) m_moved.push_back(leaf);
+				m_tree.SetUserData(leaf, i);
+			}
+			m_seenFrame[p.entity] = m_frame;
+		}
+		m_reinserted = m_moved.size();
+
+		// --- 2. t[Ȃ̂폜 ---
+		for (size_t k = 0; k < m_entities.size();)
+		{
+			Entity e = m_entities[k];
+			if (m_seenFrame[e] != m_frame)
+			{
+				m_tree.DestroyProxy(m_entityToLeaf[e]);
+				m_entityToLeaf[e] = DynamicAABBTree::NullNode;
+				m_entities[k] = m_entities.back();
+				m_entities.pop_back();
+			}
+			else
+			{
+				++k;
+			}
+		}
+
+		// --- 3. Ot[̑ĝAtĂ fat AABB ܂dȂĂ̂c ---
+		// i폜ꂽt̔ԍ͂̃t[ɂ͍ėpȂ̂ŁAŊmɎ菜j
+		size_t keep = 0;
+		for (uint64_t key : m_pairs)
+		{
+			int32_t a = (int32_t)(key >> 32);
+			int32_t b = (int32_t)(key & 0xFFFFFFFF);
+			if (m_tree.IsProxy(a) && m_tree.IsProxy(b) && m_tree.GetFatAABB(a).Overlaps(m_tree.GetFatAABB(b)))
+			{
+				m_pairs[keep++] = key;
+			}
+		}
+		m_pairs.resize(keep);
+
+		// --- 4. tc[āAVgǉ ---
+		for (int32_t leaf : m_moved)
+		{
+			if (!m_tree.IsProxy(leaf)) continue;	// ǉɍ폜ꂽꍇ
+			m_tree.Query(m_tree.GetFatAABB(leaf), [&](int32_t other)
+				{
+					if (other != leaf) m_pairs.push_back(MakeKey(leaf, other));
+					return true;
+				});
+		}
+		std::sort(m_pairs.begin(), m_pairs.end());
+		m_pairs.erase(std::unique(m_pairs.begin(), m_pairs.end()), m_pairs.end());
+
+		// --- 5. ۂAABBōi荞݁Aproxies ̓Yɕϊďo ---
+		outPairs.clear();
+		for (uint64_t key : m_pairs)
+		{
+			uint32_t pa = m_tree.GetUserData((int32_t)(key >> 32));
+			uint32_t pb = m_tree.GetUserData((int32_t)(key & 0xFFFFFFFF));
+			AABB a = { proxies[pa].aabbMin, proxies[pa].aabbMax };
+			AABB b = { proxies[pb].aabbMin, proxies[pb].aabbMax };
+			if (!a.Overlaps(b)) continue;
+			outPairs.push_back(pa < pb ? BroadphasePair(pa, pb) : BroadphasePair(pb, pa));
+		}
+		std::sort(outPairs.begin(), outPairs.end());
+	}
+}
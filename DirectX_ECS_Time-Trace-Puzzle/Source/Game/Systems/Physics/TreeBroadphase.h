@@ -0,0 +1,64 @@
+/*****************************************************************//**
+ * @file	TreeBroadphase.h
+ * @brief	IAABBc[ɂu[htF[Y
+ *
+ * @details
+ * Entity ƂɃc[̗tAfat AABB ͂ݏôđ}܂B
+ * fat AABB mdȂt̑gێĂAđ}ꂽtc[Ō܂B
+ * ȏȂǃObh̃ZɎ܂Ȃ̂ĂĂ\܂B
+ * c[CLXg͈͌ɂg܂iGetTreejB
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+#ifndef ___TREE_BROADPHASE_H___
+#define ___TREE_BROADPHASE_H___
+
+// ===== CN[h =====
+#include "Game/Systems/Physics/Broadphase.h"
+#include "Game/Systems/Physics/DynamicAABBTree.h"
+
+namespace Physics
+{
+	class TreeBroadphase
+		: public IBroadphase
+	{
+	public:
+		void Update(const std::vector<CollisionProxy>& proxies, std::vector<BroadphasePair>& outPairs) override;
+		BroadphaseType GetType() const override { return BroadphaseType::DynamicTree; }
+
+		// t userData ͍t[ proxies ̓Y
+		const DynamicAABBTree& GetTree() const { return m_tree; }
+
+		// O Update ōđ}ꂽt̐
+		size_t GetReinsertCount() const { return m_reinserted; }
+
+	private:
+		static uint64_t MakeKey(int32_t a, int32_t b)
+		{
+			if (a > b) std::swap(a, b);
+			return ((uint64_t)(uint32_t)a << 32) | (uint32_t)b;
+		}
+
+		DynamicAABBTree m_tree{ 0.1f };
+		std::vector<int32_t> m_moved;			// t[ǉEđ}ꂽt
+		std::vector<uint64_t> m_pairs;			// fat AABB dȂĂt̑gij
+		std::vector<int32_t> m_entityToLeaf;	// Entity -> t
+		std::vector<uint32_t> m_seenFrame;		// Entity -> ŌɍXVꂽt[
+		std::vector<Entity> m_entities;			// tĂ Entity
+		uint32_t m_frame = 0;
+		size_t m_reinserted = 0;
+	};
+}
+
+#endif // !___TREE_BROADPHASE_H___
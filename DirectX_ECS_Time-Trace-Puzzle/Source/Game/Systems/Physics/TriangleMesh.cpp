@@ -0,0 +1,180 @@
+/*****************************************************************//**
+ * @file	TriangleMesh.cpp
+ * @brief	MeshCollider p̎Op`bVifƂ1Af Collider ŋLj
+ *
+ * @details
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	iȗj
+ *********************************************************************/
+
+// ===== CN[h =====
+#define NOMINMAX
+#include "Game/Systems/Physics/StrictFloat.h"
+#include "Game/Systems/Physics/TriangleMesh.h"
+#include "Engine/Resource/ResourceManager.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace Physics
+{
+	namespace
+	{
+		// Op`AABBL [m]iȂǎɕsȎOp`AABB 0 ɂȂȂ悤Ɂj
+		constexpr float BoundsMargin = 1e-4f;
+	}
+
+	void TriangleMesh::Build(std::vector<XMFLOAT3> vertices, const std::vector<uint32_t>& indices)
+	{
+		m_vertices = std::move(vertices);
+		m_triangles.clear();
+		m_triangles.reserve(indices.size() / 3);
+
+		// --- 1. gOp`cAꂼAABB߂ ---
+		std::vector<AABB> bounds;
+		bounds.reserve(indices.size() / 3);
+		for (size_t k = 0; k + 2 < indices.size(); k += 3) {
+			Triangle t = { { indices[k], indices[k + 1], indices[k + 2] } };
+			if (t.i[0] >= m_vertices.size() || t.i[1] >= m_vertices.size() || t.i[2] >= m_vertices.size()) continue;
+
+			XMVECTOR a = XMLoadFloat3(&m_vertices[t.i[0]]);
+			XMVECTOR b = XMLoadFloat3(&m_vertices[t.i[1]]);
+			XMVECTOR c = XMLoadFloat3(&m_vertices[t.i[2]]);
+			if (XMVectorGetX(XMVector3LengthSq(XMVector3Cross(b - a, c - a))) < 1e-16f) continue;
+
+			AABB box;
+			XMStoreFloat3(&box.min, XMVectorMin(a, XMVectorMin(b, c)) - XMVectorReplicate(BoundsMargin));
+			XMStoreFloat3(&box.max, XMVectorMax(a, XMVectorMax(b, c)) + XMVectorReplicate(BoundsMargin));
+			m_triangles.push_back(t);
+			bounds.push_back(box);
+		}
+
+		// --- 2. ŜAABB BVH ---
+		m_bounds = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+		if (!bounds.empty()) {
+			m_bounds = bounds[0];
+			for (const auto& box : bounds) m_bounds = AABB::Union(m_bounds, box);
+		}
+		m_bvh.Build(bounds);
+	}
+
+	bool TriangleMesh::RayCast(const XMFLOAT3& origin, const XMFLOAT3& dir, float maxDist, float& outDist, uint32_t* outTriangle) const
+	{
+		XMVECTOR o = XMLoadFloat3(&origin);
+		XMVECTOR d = XMLoadFloat3(&dir);
+		bool hit = false;
+		uint32_t best = 0;
+
+		m_bvh.RayCast(origin, dir, maxDist, [&](uint32_t item, float limit) {
+			// Moller-Trumboreiʁj
+			const Triangle& t = m_triangles[item];
+			XMVECTOR a = XMLoadFloat3(&m_vertices[t.i[0]]);
+			XMVECTOR e1 = XMLoadFloat3(&m_vertices[t.i[1]]) - a;
+			XMVECTOR e2 = XMLoadFloat3(&m_vertices[t.i[2]]) - a;
+
+			XMVECTOR p = XMVector3Cross(d, e2);
+			float det = XMVectorGetX(XMVector3Dot(e1, p));
+			if (std::abs(det) < 1e-12f) return limit;
+			float inv = 1.0f / det;
+
+			XMVECTOR s = o - a;
+			float u = XMVectorGetX(XMVector3Dot(s, p)) * inv;
+			if (u < 0.0f || u > 1.0f) return limit;
+
+			XMVECTOR q = XMVector3Cross(s, e1);
+			float v = XMVectorGetX(XMVector3Dot(d, q)) * inv;
+			if (v < 0.0f || u + v > 1.0f) return limit;
+
+			float dist = XMVectorGetX(XMVector3Dot(e2, q)) * inv;
+			if (dist < 0.0f || dist > limit) return limit;
+
+			// Ȃԍ̏Op`iH鏇ɂ炸ʂɂj
+			if (hit && dist == limit && best < item) return limit;
+			hit = true;
+			best = item;
+			outDist = dist;
+			return dist;
+			});
+		if (hit && outTriangle) *outTriangle = best;
+		return hit;
+	}
+
+	uint32_t TriangleMeshLibrary::GetId(const std::string& modelKey)
+	{
+		auto it = m_ids.find(modelKey);
+		if (it != m_ids.end()) return it->second;
+
+		// ǂ߂Ȃ̂́Af̓o^Eǂݍ݂܂œǂݒȂit[ǂݒȂ悤Ɂj
+		// Op`͕`p Model ł͂ȂAŏ߂ăt@Cǂ
+		ResourceManager& resources = ResourceManager::Instance();
+		const uint64_t revision = resources.GetModelRevision();
+		auto failed = m_failed.find(modelKey);
+		if (failed != m_failed.end() && failed->second == revision) return InvalidMeshId;
+
+		std::vector<XMFLOAT3> vertices;
+		std::vector<uint32_t> indices;
+		if (!resources.LoadCollisionMesh(modelKey, vertices, indices)) {
+			m_failed[modelKey] = revision;
+			return InvalidMeshId;
+		}
+
+		return Register(modelKey, std::move(vertices), indices);
+	}
+
+	uint64_t TriangleMeshLibrary::GetModelRevision() const
+	{
+		return ResourceManager::Instance().GetModelRevision();
+	}
+
+	uint32_t TriangleMeshLibrary::Register(const std::string& key, std::vector<XMFLOAT3> vertices, const std::vector<uint32_t>& indices)
+	{
+		auto mesh = std::make_unique<TriangleMesh>();
+		mesh->Build(std::move(vertices), indices);
+		const uint64_t before = m_generation++;
+		m_failed.erase(key);
+
+		auto it = m_ids.find(key);
+		if (it != m_ids.end()) {
+			m_meshes[it->second] = std::move(mesh);
+			m_lastAdded.clear();
+			return it->second;
+		}
+		const uint32_t id = (uint32_t)m_meshes.size();
+		m_meshes.push_back(std::move(mesh));
+		m_ids[key] = id;
+		m_lastAdded = key;
+		m_lastAddedGeneration = before;
+		return id;
+	}
+
+	void TriangleMeshLibrary::Unregister(const std::string& key)
+	{
+		auto it = m_ids.find(key);
+		if (it == m_ids.end()) return;
+		const uint32_t id = it->second;
+		m_ids.erase(it);
+
+		// Oɒǉ̂ȂAԍo^Oɖ߂
+		if (key == m_lastAdded && id + 1 == m_meshes.size() && m_generation == m_lastAddedGeneration + 1) {
+			m_meshes.pop_back();
+			m_generation = m_lastAddedGeneration;
+		}
+		else {
+			// ԍ͋l߂Ȃi̔ԍςȂ悤ɁA󂯂܂܂ɂj
+			m_meshes[id].reset();
+			++m_generation;
+		}
+		m_lastAdded.clear();
+	}
+}
@@ -0,0 +1,152 @@
+/*****************************************************************//**
+ * @file	TriangleMesh.h
+ * @brief	MeshCollider p̎Op`bVifƂ1Af Collider ŋLj
+ *
+ * @details
+ * f̒_ʒuƃCfbNXfԂ̂܂܎AOp`ƂAABB
+ * StaticBVH x܂im[h 32 oCgE[D̘AzjB
+ * 蔻ECLXgł́AfԂɈڂĂ BVH HA
+ * ̎Op`[hԂɈڂĔ肵܂iCX^XƂɎOp`ȂjB
+ *
+ * ŕׂ̑ɒn`E1̓蔻ɂƁA
+ * u[htF[Yɂ\o[ɂ1̑ƂĂoĂȂȂ܂B
+ *
+ * ------------------------------------------------------------
+ * @author	Iwai Shogo
+ * ------------------------------------------------------------
+ *
+ * @date	2026/10/19	쐬
+ * 			ƓeF	- ǉF
+ *
+ * @update	2025/xx/xx	ŏIXV
+ * 			ƓeF	- XXF
+ *
+ * @note	Op`͗ʂƂ܂i[߂荞񂾂̂͗։o܂jB
+ *			MeshCollider m͔肵܂in`ȂǓȂ̂ɎgzłjB
+ *********************************************************************/
+
+#ifndef ___TRIANGLE_MESH_H___
+#define ___TRIANGLE_MESH_H___
+
+// ===== CN[h =====
+#include "Game/Systems/Physics/StaticBVH.h"
+#include <DirectXMath.h>
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <cstdint>
+
+namespace Physics
+{
+	/**
+	 * @class	TriangleMesh
+	 * @brief	fԂ̎Op`ƁA BVH
+	 */
+	class TriangleMesh
+	{
+	public:
+		// indices 31̎Op`i͈͊O̔ԍEʐς̖Op`͎̂Ăj
+		void Build(std::vector<DirectX::XMFLOAT3> vertices, const std::vector<uint32_t>& indices);
+
+		size_t GetTriangleCount() const { return m_triangles.size(); }
+		size_t GetVertexCount() const { return m_vertices.size(); }
+		size_t GetNodeCount() const { return m_bvh.GetNodeCount(); }
+		const AABB& GetBounds() const { return m_bounds; }
+
+		// Op` index ̒_ifԁj
+		void GetTriangle(uint32_t index, DirectX::XMFLOAT3& a, DirectX::XMFLOAT3& b, DirectX::XMFLOAT3& c) const
+		{
+			const Triangle& t = m_triangles[index];
+			a = m_vertices[t.i[0]];
+			b = m_vertices[t.i[1]];
+			c = m_vertices[t.i[2]];
+		}
+
+		/**
+		 * @brief	fԂ aabb ƏdȂOp`
+		 * @param	func	void(uint32_t triangle)
+		 */
+		template<typename Func>
+		void Query(const AABB& aabb, Func func) const { m_bvh.Query(aabb, func); }
+
+		/**
+		 * @brief	fԂ̃Cƈԋ߂Op`
+		 * @param	dir		KȂĂ悢i dir ̒ 1 Ƃlj
+		 */
+		bool RayCast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& dir, float maxDist, float& outDist, uint32_t* outTriangle = nullptr) const;
+
+	private:
+		struct Triangle
+		{
+			uint32_t i[3];
+		};
+
+		std::vector<DirectX::XMFLOAT3> m_vertices;
+		std::vector<Triangle> m_triangles;
+		StaticBVH m_bvh;
+		AABB m_bounds = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+	};
+
+	// TriangleMeshLibrary ̔ԍifǂ߂ĂȂj
+	constexpr uint32_t InvalidMeshId = 0xFFFFFFFFu;
+
+	/**
+	 * @class	TriangleMeshLibrary
+	 * @brief	L[Ƃ TriangleMeshi߂ĎgꂽɍAȌ͋Lj
+	 *
+	 * vLV̓|C^łȂԍŎ܂i4 oCgȂ̂ CollisionProxy ̑傫ςȂjB
+	 */
+	class TriangleMeshLibrary
+	{
+	public:
+		static TriangleMeshLibrary& Instance()
+		{
+			static TriangleMeshLibrary instance;
+			return instance;
+		}
+
+		// f̃L[iResourceManagerj̃bVS܂Ƃ߂̂̔ԍBǂ߂Ȃ InvalidMeshId
+		// ǂ߂ȂL[́AResourceManager fVo^Eǂݍ݂܂œǂݒȂ
+		uint32_t GetId(const std::string& modelKey);
+
+		// V ̂́Bǂ߂Ȃ nullptr
+		const TriangleMesh* Get(const std::string& modelKey) { return Find(GetId(modelKey)); }
+
+		const TriangleMesh* Find(uint32_t id) const { return id < m_meshes.size() ? m_meshes[id].get() : nullptr; }
+
+		// fɓo^i葱̒n`EvpjBL[͓ԍ̂܂ܒu
+		uint32_t Register(const std::string& key, std::vector<DirectX::XMFLOAT3> vertices, const std::vector<uint32_t>& indices);
+
+		/**
+		 * @brief	Register ňꎞIɓo^̂Oivpj
+		 * @details	Ōɒǉ̂ŁǍɓo^EuEClear ΁Ao^Oɖ߂܂
+		 *			i̊ԂɓĂȂ CollisionSystem ͍蒼ɍςށjBȊO͊OĐi߂܂B
+		 *			ꎞIȃbVg CollisionSystem jĂĂԂƁB
+		 */
+		void Unregister(const std::string& key);
+
+		// V[؂ւȂǁigĂ Collider ĂԂƁj
+		void Clear() { m_meshes.clear(); m_ids.clear(); m_failed.clear(); m_lastAdded.clear(); ++m_generation; }
+
+		size_t GetMeshCount() const { return m_meshes.size(); }
+
+		// o^EuEClear ̂тɑivLV͂ꂪς蒼j
+		uint64_t GetGeneration() const { return m_generation; }
+
+		// ResourceManager ̃f̓o^Eǂݍ݂̉񐔁iꂪς܂ŁAǂ߂ȂL[ InvalidMeshId ̂܂܁j
+		uint64_t GetModelRevision() const;
+
+	private:
+		TriangleMeshLibrary() = default;
+
+		std::vector<std::unique_ptr<TriangleMesh>> m_meshes;	// ԍ
+		std::map<std::string, uint32_t> m_ids;
+		std::map<std::string, uint64_t> m_failed;	// ǂ߂ȂL[ƁA̎ ResourceManager::GetModelRevision
+		uint64_t m_generation = 0;
+		std::string m_lastAdded;				// ŌɐVǉL[iUnregister Ōɖ߂邩j
+		uint64_t m_lastAddedGeneration = 0;		// V ǉO̐
+	};
+}
+
+#endif // !___TRIANGLE_MESH_H___